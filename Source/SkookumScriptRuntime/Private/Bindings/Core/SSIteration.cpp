@@ -0,0 +1,313 @@
+//=======================================================================================
+// SkookumScript C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// SkookumScript Unreal Engine Bindings
+//
+// Based on:
+//   Immediate iteration methods of the core List and Integer classes
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "../../SkookumScriptRuntimePrivatePCH.h"
+#include "SSIteration.hpp"
+
+#include <SkookumScript/SSInteger.hpp>
+
+
+namespace SSIteration
+  {
+
+  //=======================================================================================
+  // Local Methods
+  //=======================================================================================
+
+  //---------------------------------------------------------------------------------------
+  // Returns `this` as the result of the List do*() methods if a result is desired
+  static inline void result_this(SSInvokedMethod * scope_p, SSInstance ** result_pp)
+    {
+    if (result_pp)
+      {
+      SSInstance * this_p = scope_p->get_this();
+
+      this_p->reference();
+      *result_pp = this_p;
+      }
+    }
+
+
+  //=======================================================================================
+  // List Methods
+  //=======================================================================================
+
+  // Notes for the List methods:
+  //   - the count is captured once at the start just like the script versions did.
+  //   - the item array is re-read for each item since the closure may modify the list.
+  //     If the list shrinks, iteration stops rather than indexing past the end.
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   List@do((ItemClass_ item) code) ThisClass_
+  void mthd_List_do(SSInvokedMethod * scope_p, SSInstance ** result_pp)
+    {
+    SSList *     list_p    = scope_p->this_as<SSList>();
+    SSClosure *  closure_p = scope_p->get_arg<SSClosure>(SSArg_1);
+    uint32_t     count     = list_p->get_count();
+    SSInstance * item_p;
+
+    for (uint32_t idx = 0u; (idx < count) && (idx < list_p->get_count()); idx++)
+      {
+      item_p = list_p->get_array()[idx];
+      item_p->reference();
+      closure_p->closure_method_call(&item_p, 1u, nullptr, scope_p);
+      }
+
+    result_this(scope_p, result_pp);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   List@do_idx((ItemClass_ item Integer idx) code) ThisClass_
+  void mthd_List_do_idx(SSInvokedMethod * scope_p, SSInstance ** result_pp)
+    {
+    SSList *     list_p    = scope_p->this_as<SSList>();
+    SSClosure *  closure_p = scope_p->get_arg<SSClosure>(SSArg_1);
+    uint32_t     count     = list_p->get_count();
+    SSInstance * args_p[2];
+
+    for (uint32_t idx = 0u; (idx < count) && (idx < list_p->get_count()); idx++)
+      {
+      args_p[0] = list_p->get_array()[idx];
+      args_p[0]->reference();
+      args_p[1] = SSInteger::as_instance(SSIntegerType(idx));
+      closure_p->closure_method_call(args_p, 2u, nullptr, scope_p);
+      }
+
+    result_this(scope_p, result_pp);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   List@do_reverse((ItemClass_ item) code) ThisClass_
+  void mthd_List_do_reverse(SSInvokedMethod * scope_p, SSInstance ** result_pp)
+    {
+    SSList *     list_p    = scope_p->this_as<SSList>();
+    SSClosure *  closure_p = scope_p->get_arg<SSClosure>(SSArg_1);
+    uint32_t     idx       = list_p->get_count();
+    SSInstance * item_p;
+
+    while (idx > 0u)
+      {
+      idx--;
+
+      if (idx < list_p->get_count())
+        {
+        item_p = list_p->get_array()[idx];
+        item_p->reference();
+        closure_p->closure_method_call(&item_p, 1u, nullptr, scope_p);
+        }
+      }
+
+    result_this(scope_p, result_pp);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   List@all?((ItemClass_ item) Boolean test) Boolean
+  void mthd_List_allQ(SSInvokedMethod * scope_p, SSInstance ** result_pp)
+    {
+    SSList *     list_p    = scope_p->this_as<SSList>();
+    SSClosure *  closure_p = scope_p->get_arg<SSClosure>(SSArg_1);
+    uint32_t     count     = list_p->get_count();
+    bool         result_b  = true;
+    SSInstance * item_p;
+
+    for (uint32_t idx = 0u; (idx < count) && (idx < list_p->get_count()); idx++)
+      {
+      item_p = list_p->get_array()[idx];
+      item_p->reference();
+
+      if (!closure_p->closure_method_query(item_p, scope_p))
+        {
+        result_b = false;
+        break;
+        }
+      }
+
+    if (result_pp)
+      {
+      *result_pp = SSBoolean::pool_new(result_b);
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   List@any?((ItemClass_ item) Boolean test) Boolean
+  void mthd_List_anyQ(SSInvokedMethod * scope_p, SSInstance ** result_pp)
+    {
+    SSList *     list_p    = scope_p->this_as<SSList>();
+    SSClosure *  closure_p = scope_p->get_arg<SSClosure>(SSArg_1);
+    uint32_t     count     = list_p->get_count();
+    bool         result_b  = false;
+    SSInstance * item_p;
+
+    for (uint32_t idx = 0u; (idx < count) && (idx < list_p->get_count()); idx++)
+      {
+      item_p = list_p->get_array()[idx];
+      item_p->reference();
+
+      if (closure_p->closure_method_query(item_p, scope_p))
+        {
+        result_b = true;
+        break;
+        }
+      }
+
+    if (result_pp)
+      {
+      *result_pp = SSBoolean::pool_new(result_b);
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   List@find?((ItemClass_ item) Boolean test; Integer index_found) Boolean
+  void mthd_List_findQ(SSInvokedMethod * scope_p, SSInstance ** result_pp)
+    {
+    SSList *     list_p    = scope_p->this_as<SSList>();
+    SSClosure *  closure_p = scope_p->get_arg<SSClosure>(SSArg_1);
+    uint32_t     count     = list_p->get_count();
+    bool         result_b  = false;
+    uint32_t     idx       = 0u;
+    SSInstance * item_p;
+
+    for (; (idx < count) && (idx < list_p->get_count()); idx++)
+      {
+      item_p = list_p->get_array()[idx];
+      item_p->reference();
+
+      if (closure_p->closure_method_query(item_p, scope_p))
+        {
+        result_b = true;
+        break;
+        }
+      }
+
+    // Bind a new Integer to the return argument rather than setting the value of whatever
+    // instance is currently bound - it may be shared.
+    scope_p->set_arg(SSArg_2, SSInteger::as_instance(SSIntegerType(idx)));
+
+    if (result_pp)
+      {
+      *result_pp = SSBoolean::pool_new(result_b);
+      }
+    }
+
+
+  //=======================================================================================
+  // Integer Methods
+  //=======================================================================================
+
+  // Notes for the Integer methods:
+  //   - `this` is read once at the start just like the script versions did.
+  //   - the script versions ended with a `loop` and so returned nil.
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Integer@do((Integer idx) code)
+  void mthd_Integer_do(SSInvokedMethod * scope_p, SSInstance ** result_pp)
+    {
+    SSIntegerType count     = *scope_p->this_as<SSIntegerType>();
+    SSClosure *   closure_p = scope_p->get_arg<SSClosure>(SSArg_1);
+
+    for (SSIntegerType idx = 0; idx < count; idx++)
+      {
+      closure_p->closure_method_call(SSInteger::as_instance(idx), nullptr, scope_p);
+      }
+
+    if (result_pp)
+      {
+      *result_pp = SSBrain::ms_nil_p;
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Integer@do_reverse((Integer idx) code)
+  void mthd_Integer_do_reverse(SSInvokedMethod * scope_p, SSInstance ** result_pp)
+    {
+    SSIntegerType idx       = *scope_p->this_as<SSIntegerType>();
+    SSClosure *   closure_p = scope_p->get_arg<SSClosure>(SSArg_1);
+
+    while (idx > 0)
+      {
+      idx--;
+      closure_p->closure_method_call(SSInteger::as_instance(idx), nullptr, scope_p);
+      }
+
+    if (result_pp)
+      {
+      *result_pp = SSBrain::ms_nil_p;
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Integer@do_by(Integer step, (Integer idx) code)
+  void mthd_Integer_do_by(SSInvokedMethod * scope_p, SSInstance ** result_pp)
+    {
+    SSIntegerType count     = *scope_p->this_as<SSIntegerType>();
+    SSIntegerType step      = *scope_p->get_arg<SSIntegerType>(SSArg_1);
+    SSClosure *   closure_p = scope_p->get_arg<SSClosure>(SSArg_2);
+
+    // Same as the script version - a `step` <= 0 with a positive count never finishes.
+    SS_ASSERTX(step > 0 || count <= 0, "Integer@do_by() called with a step that is not positive!");
+
+    for (SSIntegerType idx = 0; idx < count; idx += step)
+      {
+      closure_p->closure_method_call(SSInteger::as_instance(idx), nullptr, scope_p);
+      }
+
+    if (result_pp)
+      {
+      *result_pp = SSBrain::ms_nil_p;
+      }
+    }
+
+
+  //=======================================================================================
+  // Registration
+  //=======================================================================================
+
+  static const SSClass::MethodInitializerFunc methods_List_i[] =
+    {
+      { "do",         mthd_List_do },
+      { "do_idx",     mthd_List_do_idx },
+      { "do_reverse", mthd_List_do_reverse },
+      { "all?",       mthd_List_allQ },
+      { "any?",       mthd_List_anyQ },
+      { "find?",      mthd_List_findQ },
+    };
+
+  static const SSClass::MethodInitializerFunc methods_Integer_i[] =
+    {
+      { "do",         mthd_Integer_do },
+      { "do_reverse", mthd_Integer_do_reverse },
+      { "do_by",      mthd_Integer_do_by },
+    };
+
+  //---------------------------------------------------------------------------------------
+  // The List and Integer classes register their other atomic methods inside the
+  // SkookumScript library - these are added on top of them.  The Core overlay keeps the
+  // script versions and the Engine overlay redeclares these methods without a body so
+  // they are only atomic when the scripts are compiled for this plug-in.
+  void register_bindings()
+    {
+    SSClass * class_p = SSBrain::get_class("List");
+
+    SS_ASSERTX(class_p, "Tried to register bindings for class 'List' but it is unknown!");
+    class_p->register_method_func_bulk(methods_List_i, A_COUNT_OF(methods_List_i), SSBindFlag_instance_no_rebind);
+
+    class_p = SSBrain::get_class("Integer");
+
+    SS_ASSERTX(class_p, "Tried to register bindings for class 'Integer' but it is unknown!");
+    class_p->register_method_func_bulk(methods_Integer_i, A_COUNT_OF(methods_Integer_i), SSBindFlag_instance_no_rebind);
+    }
+
+  } // SSIteration
@@ -0,0 +1,67 @@
+//=======================================================================================
+// SkookumScript C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// SkookumScript Unreal Engine Bindings
+//
+// Based on:
+//   Immediate iteration methods of the core List and Integer classes
+//=======================================================================================
+
+
+#ifndef __SSITERATION_HPP
+#define __SSITERATION_HPP
+#pragma once
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AgogCore.hpp"
+
+
+//=======================================================================================
+// Global Data/Methods
+//=======================================================================================
+
+// Pre-declarations
+class SSInvokedMethod;
+class SSInstance;
+
+
+//---------------------------------------------------------------------------------------
+// Atomic (C++) versions of the immediate closure iteration methods - List@do(),
+// List@all?(), Integer@do(), etc.  These are written in script in the Core overlay and
+// are called so often that the per-item `at()`, compare and increment calls dominate
+// their cost.  The Engine overlay overrides them with these versions which call the
+// closure directly with each item - semantics (including early exit for all?(), any?()
+// and find?()) are the same as the script versions.
+namespace SSIteration
+  {
+
+  // Methods
+
+    void register_bindings();
+
+    // List methods
+
+    void mthd_List_do(SSInvokedMethod * scope_p, SSInstance ** result_pp);
+    void mthd_List_do_idx(SSInvokedMethod * scope_p, SSInstance ** result_pp);
+    void mthd_List_do_reverse(SSInvokedMethod * scope_p, SSInstance ** result_pp);
+    void mthd_List_allQ(SSInvokedMethod * scope_p, SSInstance ** result_pp);
+    void mthd_List_anyQ(SSInvokedMethod * scope_p, SSInstance ** result_pp);
+    void mthd_List_findQ(SSInvokedMethod * scope_p, SSInstance ** result_pp);
+
+    // Integer methods
+
+    void mthd_Integer_do(SSInvokedMethod * scope_p, SSInstance ** result_pp);
+    void mthd_Integer_do_reverse(SSInvokedMethod * scope_p, SSInstance ** result_pp);
+    void mthd_Integer_do_by(SSInvokedMethod * scope_p, SSInstance ** result_pp);
+
+  } // SSIteration
+
+
+#endif // __SSITERATION_HPP
+
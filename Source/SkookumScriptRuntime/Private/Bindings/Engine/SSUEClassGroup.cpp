@@ -0,0 +1,53 @@
+//=======================================================================================
+// SkookumScript C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// SkookumScript Unreal Engine Bindings
+//
+// Based on:
+//   Demand loaded class group hints for script - see SSUERuntime
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "../../SkookumScriptRuntimePrivatePCH.h"
+#include "SSUEClassGroup.hpp"
+#include "../SSUERuntime.hpp"
+
+
+namespace SSUEClassGroup
+  {
+
+  //=======================================================================================
+  // Object Class Methods
+  //=======================================================================================
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Object@prefetch_group() Boolean
+  void mthdc_prefetch_group(SSInvokedMethod * scope_p, SSInstance ** result_pp)
+    {
+    SSClass * class_p   = &((SSMetaClass *)scope_p->get_topmost_scope())->get_class_info();
+    bool      started_b = SSUERuntime::get_singleton()->prefetch_class_group(*class_p);
+
+    if (result_pp)
+      {
+      *result_pp = SSBoolean::pool_new(started_b);
+      }
+    }
+
+  static const SSClass::MethodInitializerFunc methods_Object_c[] =
+    {
+      { "prefetch_group", mthdc_prefetch_group },
+    };
+
+  //---------------------------------------------------------------------------------------
+  void register_bindings()
+    {
+    SSBrain::ms_object_class_p->register_method_func_bulk(methods_Object_c, A_COUNT_OF(methods_Object_c), SSBindFlag_class_no_rebind);
+    }
+
+  } // SSUEClassGroup
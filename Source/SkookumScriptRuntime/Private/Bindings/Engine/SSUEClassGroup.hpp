@@ -0,0 +1,50 @@
+//=======================================================================================
+// SkookumScript C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// SkookumScript Unreal Engine Bindings
+//
+// Based on:
+//   Demand loaded class group hints for script - see SSUERuntime
+//=======================================================================================
+
+
+#ifndef __SSUECLASSGROUP_HPP
+#define __SSUECLASSGROUP_HPP
+#pragma once
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "AgogCore/AgogCore.hpp"
+
+
+//=======================================================================================
+// Global Data/Methods
+//=======================================================================================
+
+// Pre-declarations
+class SSInvokedMethod;
+class SSInstance;
+
+
+//---------------------------------------------------------------------------------------
+// Lets script ask for demand loaded class groups ahead of time - Object@prefetch_group()
+namespace SSUEClassGroup
+  {
+
+  // Methods
+
+    void register_bindings();
+
+    // Object class methods
+
+    void mthdc_prefetch_group(SSInvokedMethod * scope_p, SSInstance ** result_pp);
+
+  } // SSUEClassGroup
+
+
+#endif // __SSUECLASSGROUP_HPP
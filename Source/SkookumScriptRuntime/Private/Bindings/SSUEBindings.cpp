@@ -25,10 +25,13 @@
 #include "VectorMath/SSTransform.hpp"
 #include "VectorMath/SSColor.hpp"
 
+#include "Core/SSIteration.hpp"
+
 #include "Engine/SSUEName.hpp"
 #include "Engine/SSUEActor.hpp"
 #include "Engine/SSUEEntity.hpp"
 #include "Engine/SSUEEntityClass.hpp"
+#include "Engine/SSUEClassGroup.hpp"
 
 //=======================================================================================
 // Engine-Generated
@@ -41,6 +44,69 @@ namespace SSUE
   TMap<UClass*, SSClass*> g_class_map_u2s;
   TMap<SSClass*, UClass*> g_class_map_s2u;
 
+  // Flattened version of g_class_map_u2s - any UClass seen by get_class_inherited() to
+  // the SSClass of its nearest mapped ancestor (or nullptr).  Cleared after every garbage
+  // collection so a collected UClass (e.g. replaced by a Blueprint recompile) can't be
+  // confused with a new UClass that reuses its address.
+  static TMap<UClass*, SSClass*> g_class_map_u2s_inherited;
+
+  // Object.@@world class data member - resolved once by get_world_var() rather than
+  // searched for by name on every access
+  static SSTypedData * g_world_var_p = nullptr;
+
+  //---------------------------------------------------------------------------------------
+  // Returns the SSClass mapped to the given UClass or to its nearest superclass that has
+  // a mapping - or nullptr if none do.
+  // 
+  // Notes:
+  //   Project and Blueprint classes are usually several levels below the closest class
+  //   known to SkookumScript so the superclass walk result is cached per UClass.  The
+  //   cache is cleared whenever the bindings (and so g_class_map_u2s) are re-registered
+  //   and by reset_class_lookups() after each garbage collection.
+  SSClass * get_class_inherited(UClass * uclass_p)
+    {
+    SSClass ** class_pp = g_class_map_u2s_inherited.Find(uclass_p);
+
+    if (class_pp)
+      {
+      return *class_pp;
+      }
+
+    // Crawl up class hierarchy until we find a class known to Sk
+    SSClass * class_p = nullptr;
+
+    for (UClass * super_uclass_p = uclass_p; !class_p && super_uclass_p; super_uclass_p = super_uclass_p->GetSuperClass())
+      {
+      class_pp = g_class_map_u2s.Find(super_uclass_p);
+
+      if (class_pp)
+        {
+        class_p = *class_pp;
+        }
+      }
+
+    g_class_map_u2s_inherited.Add(uclass_p, class_p);
+
+    return class_p;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Called whenever bindings are re-registered since classes and their data members are
+  // recreated when compiled binaries are (re)loaded.
+  void reset_lookups()
+    {
+    g_class_map_u2s_inherited.Reset();
+    g_world_var_p = nullptr;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Called after each garbage collection since any UClass cached by get_class_inherited()
+  // may have been collected and its address reused.  The cache is cheap to rebuild.
+  void reset_class_lookups()
+    {
+    g_class_map_u2s_inherited.Reset();
+    }
+
   //---------------------------------------------------------------------------------------
   // Create an instance on the fly based on the given object's class
   SSInstance * get_object_instance(UObject * obj_p, UClass * def_uclass_p, SSClass * def_class_p)
@@ -52,16 +118,12 @@ namespace SSUE
       UClass * obj_uclass_p = obj_p->GetClass();
       if (obj_uclass_p != def_uclass_p)
         {
-        // Crawl up class hierarchy until we find a class known to Sk
-        SSClass ** class_pp = nullptr;
-        for (; !class_pp && obj_uclass_p; obj_uclass_p = obj_uclass_p->GetSuperClass())
+        // Find closest class known to Sk
+        // UE classes can be specific to projects and thus not known to Sk
+        SSClass * known_class_p = get_class_inherited(obj_uclass_p);
+        if (known_class_p)
           {
-          class_pp = g_class_map_u2s.Find(obj_uclass_p);
-          //SS_ASSERTX(class_pp, "Unknown object class!"); // UE classes can be specific to projects and thus not known to Sk
-          }
-        if (class_pp)
-          {
-          class_p = *class_pp;
+          class_p = known_class_p;
           }
         }
       }
@@ -107,18 +169,17 @@ namespace SSUE
     }
 
   //---------------------------------------------------------------------------------------
-  // Fetch world from Object.@@world
-  UWorld * get_world()
+  // Fetch Object.@@world class data member
+  SSTypedData * get_world_var()
     {
-    static SSTypedData * world_var_p = nullptr;
-    if (!world_var_p)
+    if (!g_world_var_p)
       {
       SSClass * obj_class_p = SSBrain::get_class(ASymbol_Object);
       SS_ASSERTX(obj_class_p, "Couldn't find the World class!");
       uint32_t var_pos;
       if (obj_class_p->get_class_data().find(ASymbolX_c_world, AMatch_first_found, &var_pos))
         {
-        world_var_p = obj_class_p->get_class_data().get_at(var_pos);
+        g_world_var_p = obj_class_p->get_class_data().get_at(var_pos);
         }
       else
         {
@@ -126,6 +187,15 @@ namespace SSUE
         }
       }
 
+    return g_world_var_p;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Fetch world from Object.@@world
+  UWorld * get_world()
+    {
+    SSTypedData * world_var_p = get_world_var();
+
     SS_ASSERTX(world_var_p->m_data_p && (world_var_p->m_data_p == SSBrain::ms_nil_p || world_var_p->m_data_p->get_class() == SSBrain::get_class(ASymbol_World)), "@@world variable does not have proper type."); // nil is ok
     return world_var_p->m_data_p == SSBrain::ms_nil_p ? nullptr : world_var_p->m_data_p->as<UWorld>();
     }
@@ -148,6 +218,9 @@ namespace SSUE
 // Registers bindings for SkookumScript
 void SSUEBindings::register_all()
   {
+  // Classes are about to be remapped
+  SSUE::reset_lookups();
+
   // VectorMath Overlay
   SSVector2::register_bindings();
   SSVector3::register_bindings();
@@ -157,6 +230,9 @@ void SSUEBindings::register_all()
   SSTransform::register_bindings();
   SSColor::register_bindings();
 
+  // Core Overlay
+  SSIteration::register_bindings();
+
   // Engine-Generated Overlay
   SSUE::register_bindings();
 
@@ -165,4 +241,5 @@ void SSUEBindings::register_all()
   SSUEEntityClass::register_bindings2();
   SSUEActor::register_bindings2();
   SSUEName::register_bindings();
+  SSUEClassGroup::register_bindings();
   }
@@ -29,6 +29,11 @@ namespace SSUE
   extern TMap<SSClass*, UClass*> g_class_map_s2u; // Maps SSClasses to their respective UClasses
 
   UWorld *      get_world(); // Get tha world
+  SSTypedData * get_world_var(); // Get Object.@@world class data member
+
+  SSClass *     get_class_inherited(UClass * uclass_p); // Most derived SSClass mapped to the given UClass or one of its superclasses - nullptr if none
+  void          reset_lookups(); // Forget results cached by get_class_inherited() and get_world_var()
+  void          reset_class_lookups(); // Forget results cached by get_class_inherited() - UClasses may have been garbage collected
 
   SSInstance *  get_object_instance(UObject * obj_p, UClass * def_uclass_p = nullptr, SSClass * def_class_p = nullptr); // Create an instance on the fly based on the given object's class
   SSInstance *  get_actor_instance(AActor * actor_p, UClass * def_uclass_p = nullptr, SSClass * def_class_p = nullptr); // Based on a given actor, create or return reference to that actor's instance
@@ -26,6 +26,33 @@ namespace
 {
   const int32_t SSUERemote_ide_port = 12357;
 
+  // Max bytes handed to the socket per Send() call when draining the send queue
+  const uint32_t SSUERemote_send_chunk = 64u * 1024u;
+
+  // Soft cap of bytes waiting in the send queue - past it on_cmd_send() warns that the
+  // remote IDE is not keeping up though it still queues the command.
+  const uint32_t SSUERemote_send_queue_max = 16u * 1024u * 1024u;
+
+  #if !UE_BUILD_SHIPPING
+
+  //---------------------------------------------------------------------------------------
+  // Accumulates FNV-1a hash of `bytes_p` - used by SSUERemote::test_loopback() to check
+  // the bytes read by the stand-in IDE against the bytes queued.
+  uint32_t SSUERemote_hash_bytes(uint32_t hash, const uint8_t * bytes_p, uint32_t length)
+    {
+    const uint8_t * bytes_end_p = bytes_p + length;
+
+    while (bytes_p < bytes_end_p)
+      {
+      hash = (hash ^ *bytes_p) * 16777619u;
+      bytes_p++;
+      }
+
+    return hash;
+    }
+
+  #endif  // !UE_BUILD_SHIPPING
+
 } // End unnamed namespace
 
 
@@ -41,7 +68,8 @@ namespace
 // #Author(s): Conan Reis
 SSUERemote::SSUERemote() :
   m_socket_p(nullptr),
-  m_data_idx(ADef_uint32)
+  m_data_idx(ADef_uint32),
+  m_send_idx(0u)
   {
   }
 
@@ -128,6 +156,73 @@ void SSUERemote::process_incoming()
     } // While connected and has data
   }
 
+//---------------------------------------------------------------------------------------
+// Sends as much of the outgoing queue as the socket will take without blocking.  Any
+// remainder (including the rest of a partially sent command) stays queued and is resumed
+// on the next call.
+// 
+// #Notes
+//   Called every tick and whenever the runtime waits on the remote IDE so commands
+//   queued by on_cmd_send() during a frame are coalesced into as few writes as possible.
+//   
+// #Author(s): Conan Reis
+void SSUERemote::process_outgoing()
+  {
+  uint32_t queue_end = uint32_t(m_send_queue.Num());
+
+  while ((m_send_idx < queue_end) && is_connected())
+    {
+    int32    bytes_sent = 0;
+    uint32_t bytes_to_send = a_min(queue_end - m_send_idx, SSUERemote_send_chunk);
+
+    if (!m_socket_p->Send(m_send_queue.GetData() + m_send_idx, int32(bytes_to_send), bytes_sent))
+      {
+      ESocketErrors error = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode();
+
+      if (error != SE_EWOULDBLOCK)
+        {
+        SSDebug::print(
+          a_str_format("SkookumScript: Error %i sending to remote IDE - %u queued bytes dropped!\n", int32(error), queue_end - m_send_idx),
+          SSLocale_local,
+          SSDPrintType_warning);
+        m_send_queue.Reset();
+        m_send_idx = 0u;
+
+        return;
+        }
+
+      bytes_sent = 0;
+      }
+
+    if (bytes_sent <= 0)
+      {
+      // Remote IDE not keeping up - try again next update
+      m_send_stats.m_sends_deferred++;
+
+      return;
+      }
+
+    m_send_stats.m_sends++;
+    m_send_stats.m_bytes_sent += uint32_t(bytes_sent);
+    m_send_idx += uint32_t(bytes_sent);
+
+    if (uint32_t(bytes_sent) < bytes_to_send)
+      {
+      // Socket buffer is full - resume from here next update
+      m_send_stats.m_sends_partial++;
+
+      return;
+      }
+    }
+
+  if (m_send_idx >= queue_end)
+    {
+    // Everything sent - keep allocation around for next batch
+    m_send_queue.Reset();
+    m_send_idx = 0u;
+    }
+  }
+
 //---------------------------------------------------------------------------------------
 // Get (ANSI) string representation of socket IP Address and port
 // 
@@ -188,7 +283,25 @@ void SSUERemote::set_mode(eSSLocale mode)
     // Stop old mode
     if (m_socket_p)
       {
+      // Give any queued commands one last chance to go out
+      process_outgoing();
+
       SSDebug::print(a_str_format("SkookumScript: Disconnecting... %s\n", get_socket_str().as_cstr()), SSLocale_local);
+      SSDebug::print(
+        a_str_format(
+          "  sent %u commands (%llu bytes) in %u writes - %u partial, %u deferred, %u over cap, %u bytes peak queue, %u bytes unsent\n",
+          m_send_stats.m_cmds_queued,
+          static_cast<unsigned long long>(m_send_stats.m_bytes_sent),
+          m_send_stats.m_sends,
+          m_send_stats.m_sends_partial,
+          m_send_stats.m_sends_deferred,
+          m_send_stats.m_queue_overflows,
+          m_send_stats.m_queue_peak,
+          get_send_queue_length()),
+        SSLocale_local);
+
+      m_send_queue.Reset();
+      m_send_idx = 0u;
 
       ISocketSubsystem * socket_system_p = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
 
@@ -242,6 +355,10 @@ void SSUERemote::set_mode(eSSLocale mode)
           return;
           }
 
+        // Sends are queued and drained by process_outgoing() so never stall the game
+        // thread waiting on the remote IDE.  Receives only read what is already pending.
+        m_socket_p->SetNonBlocking(true);
+
         SSDebug::print(a_str_format("SkookumScript: Connected %s\n", get_socket_str().as_cstr()), SSLocale_local);
 
         set_connect_state(ConnectState_authenticating);
@@ -252,29 +369,60 @@ void SSUERemote::set_mode(eSSLocale mode)
   }
 
 //---------------------------------------------------------------------------------------
-// Sends a command in datum form to the remote IDE
+// Queues a command in datum form to be sent to the remote IDE
 // 
 // #Params
 //   datum: command in datum form from a cmd_*() method
 //   
+// #Notes
+//   The datum is copied to the send queue and actually sent by process_outgoing() - see
+//   it for more info.
+//   
+//   This never waits on the remote IDE.  If the queue is past SSUERemote_send_queue_max
+//   it tries to send what the socket will take and then queues the command anyway - it
+//   cannot be dropped without corrupting the stream.  Only the first overflow is reported.
+//   
 // #Modifiers: virtual
 // #Author(s): Conan Reis
 void SSUERemote::on_cmd_send(const ADatum & datum)
   {
   if (is_connected())
     {
-    int32 bytes_sent = 0;
-
-    // $Note - CReis Assumes that Send() is able to transfer entire datum in 1 pass.
-    m_socket_p->Send(datum.get_buffer(), datum.get_length(), bytes_sent);
-
-    //if (bytes_sent < int32(datum.get_length()))
-    //  {
-    //  SSDebug::print(
-    //    "SkookumScript: Only part of the data was sent to the remote IDE!!\n",
-    //    SSLocale_local,
-    //    SSDPrintType_warning);
-    //  }
+    uint32_t datum_length = datum.get_length();
+
+    if ((get_send_queue_length() + datum_length) > SSUERemote_send_queue_max)
+      {
+      process_outgoing();
+
+      if (is_connected()
+        && ((get_send_queue_length() + datum_length) > SSUERemote_send_queue_max))
+        {
+        if (m_send_stats.m_queue_overflows++ == 0u)
+          {
+          SSDebug::print(
+            a_str_format(
+              "SkookumScript: Remote IDE is not keeping up - %u bytes waiting to be sent!\n",
+              get_send_queue_length()),
+            SSLocale_local,
+            SSDPrintType_warning);
+          }
+        }
+      }
+
+    // Discard already sent bytes once they make up at least half of the queue so the
+    // unsent remainder is moved at most once per byte sent rather than every append.
+    if ((m_send_idx >= SSUERemote_send_chunk)
+      && (m_send_idx >= (uint32_t(m_send_queue.Num()) >> 1u)))
+      {
+      m_send_queue.RemoveAt(0, int32(m_send_idx), false);
+      m_send_idx = 0u;
+      }
+
+    m_send_queue.Append(datum.get_buffer(), int32(datum_length));
+
+    m_send_stats.m_cmds_queued++;
+    m_send_stats.m_bytes_queued += datum_length;
+    m_send_stats.m_queue_peak    = a_max(m_send_stats.m_queue_peak, uint32_t(m_send_queue.Num()));
     }
   else
     {
@@ -296,6 +444,7 @@ double SSUERemote::get_elapsed_seconds()
 void SSUERemote::wait_for_update()
   {
   FPlatformProcess::Sleep(.1f);
+  process_outgoing();
   process_incoming();
   }
 
@@ -376,5 +525,198 @@ AString SSUERemote::get_project_path()
   return FStringToAString(FPaths::ConvertRelativePathToFull(project_path));
   }
 
+#if !UE_BUILD_SHIPPING
+
+//---------------------------------------------------------------------------------------
+// Sends `cmd_count` commands of `cmd_bytes` each over a loopback connection to a stand-in
+// remote IDE that reads at most `read_bytes_per_tick` bytes per simulated tick and checks
+// that they all arrive intact and in order without on_cmd_send() stalling.
+// 
+// Returns:  true if test passed
+// 
+// #Notes
+//   Only runs while not connected to the real remote IDE - it borrows the socket and send
+//   queue of this object and restores them afterwards.
+//   Called by the sk.TestRemoteLoopback console command.
+//   
+// #Author(s): Conan Reis
+bool SSUERemote::test_loopback(
+  uint32_t cmd_count,
+  uint32_t cmd_bytes,
+  uint32_t read_bytes_per_tick
+  )
+  {
+  if (m_socket_p)
+    {
+    SSDebug::print(
+      "SkookumScript: Disconnect from the remote IDE before running the loopback test!\n",
+      SSLocale_local,
+      SSDPrintType_warning);
+
+    return false;
+    }
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Connect to stand-in remote IDE listening on an ephemeral loopback port
+  ISocketSubsystem * socket_system_p = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+  FSocket *          client_p        = nullptr;
+  FSocket *          ide_p           = nullptr;
+  bool               pending_b       = false;
+  FSocket *          listen_p        = FTcpSocketBuilder(TEXT("SkookumIDE.LoopbackListen"))
+    .AsReusable()
+    .BoundToAddress(FIPv4Address(127u, 0u, 0u, 1u))
+    .Listening(1);
+
+  if (listen_p)
+    {
+    TSharedRef<FInternetAddr> ide_addr = socket_system_p->CreateInternetAddr(
+      0x7f000001u, uint32(listen_p->GetPortNo()));
+
+    client_p = FTcpSocketBuilder(TEXT("SkookumIDE.LoopbackClient")).AsReusable();
+
+    if (client_p
+      && client_p->Connect(*ide_addr)
+      && listen_p->WaitForPendingConnection(pending_b, FTimespan::FromSeconds(1.0))
+      && pending_b)
+      {
+      ide_p = listen_p->Accept(TEXT("SkookumIDE.LoopbackIDE"));
+      }
+    }
+
+  bool passed_b = false;
+
+  if (ide_p)
+    {
+    // Small socket buffers so the slow stand-in IDE pushes back quickly
+    int32 buffer_size = 0;
+
+    client_p->SetNonBlocking(true);
+    client_p->SetSendBufferSize(int32(SSUERemote_send_chunk), buffer_size);
+    ide_p->SetNonBlocking(true);
+    ide_p->SetReceiveBufferSize(int32(SSUERemote_send_chunk), buffer_size);
+
+    SendStats stats_prev = m_send_stats;
+
+    m_send_stats = SendStats();
+    m_socket_p   = client_p;
+
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // Each tick queues a few commands, drains what the socket will take and has the
+    // stand-in IDE read a little.  Both ends hash the bytes so drops, duplicates and
+    // reordering are all caught.
+    const uint32_t cmds_per_tick  = 8u;
+    const uint32_t idle_ticks_max = 1000u;
+
+    ADatum        datum(cmd_bytes);
+    TArray<uint8> read_buffer;
+    uint64_t      bytes_queued  = 0u;
+    uint64_t      bytes_read    = 0u;
+    uint32_t      hash_queued   = 2166136261u;
+    uint32_t      hash_read     = 2166136261u;
+    uint32_t      cmds_queued   = 0u;
+    uint32_t      ticks         = 0u;
+    uint32_t      idle_ticks    = 0u;
+    double        send_secs_max = 0.0;
+
+    read_buffer.SetNumUninitialized(int32(read_bytes_per_tick));
+
+    while (is_connected()
+      && ((cmds_queued < cmd_count) || (bytes_read < bytes_queued))
+      && (idle_ticks < idle_ticks_max))
+      {
+      for (uint32_t tick_cmd = 0u; (tick_cmd < cmds_per_tick) && (cmds_queued < cmd_count); tick_cmd++)
+        {
+        uint8_t * data_p = datum.get_data_writable();
+
+        for (uint32_t byte_idx = 0u; byte_idx < cmd_bytes; byte_idx++)
+          {
+          data_p[byte_idx] = uint8_t(cmds_queued + byte_idx);
+          }
+
+        hash_queued   = SSUERemote_hash_bytes(hash_queued, datum.get_buffer(), datum.get_length());
+        bytes_queued += datum.get_length();
+
+        double send_start = FPlatformTime::Seconds();
+
+        on_cmd_send(datum);
+        send_secs_max = a_max(send_secs_max, FPlatformTime::Seconds() - send_start);
+        cmds_queued++;
+        }
+
+      process_outgoing();
+
+      int32 bytes_recv = 0;
+
+      if (ide_p->Recv(read_buffer.GetData(), read_buffer.Num(), bytes_recv) && (bytes_recv > 0))
+        {
+        hash_read   = SSUERemote_hash_bytes(hash_read, read_buffer.GetData(), uint32_t(bytes_recv));
+        bytes_read += uint32_t(bytes_recv);
+        idle_ticks  = 0u;
+        }
+      else
+        {
+        // Nothing arrived yet - give loopback a moment
+        idle_ticks++;
+        FPlatformProcess::Sleep(0.001f);
+        }
+
+      ticks++;
+      }
+
+    // A stall would be the blocking wait for the queue to drain coming back
+    passed_b = (cmds_queued == cmd_count)
+      && (bytes_read == bytes_queued)
+      && (hash_read == hash_queued)
+      && (send_secs_max < 0.1);
+
+    SSDebug::print(
+      a_str_format(
+        "SkookumScript: Remote loopback test %s - %u commands, %llu of %llu bytes read in %u ticks\n"
+        "  %u writes - %u partial, %u deferred, %u over cap, %u bytes peak queue, %.3fms longest on_cmd_send()\n",
+        passed_b ? "passed" : "FAILED",
+        cmds_queued,
+        static_cast<unsigned long long>(bytes_read),
+        static_cast<unsigned long long>(bytes_queued),
+        ticks,
+        m_send_stats.m_sends,
+        m_send_stats.m_sends_partial,
+        m_send_stats.m_sends_deferred,
+        m_send_stats.m_queue_overflows,
+        m_send_stats.m_queue_peak,
+        send_secs_max * 1000.0),
+      SSLocale_local,
+      passed_b ? SSDPrintType_standard : SSDPrintType_warning);
+
+    m_send_queue.Empty();
+    m_send_idx   = 0u;
+    m_socket_p   = nullptr;
+    m_send_stats = stats_prev;
+    }
+  else
+    {
+    SSDebug::print(
+      "SkookumScript: Remote loopback test could not connect to its stand-in remote IDE!\n",
+      SSLocale_local,
+      SSDPrintType_warning);
+    }
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Clean up
+  FSocket * sockets_p[] = {ide_p, client_p, listen_p};
+
+  for (FSocket * socket_p : sockets_p)
+    {
+    if (socket_p)
+      {
+      socket_p->Close();
+      socket_system_p->DestroySocket(socket_p);
+      }
+    }
+
+  return passed_b;
+  }
+
+#endif  // !UE_BUILD_SHIPPING
+
 
 #endif  // SKOOKUM_REMOTE_UNREAL
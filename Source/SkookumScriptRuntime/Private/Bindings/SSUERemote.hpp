@@ -38,15 +38,52 @@ class SSUERemote : public SkookumRemoteRuntimeBase
   {
   public:
 
+  // Nested Structures
+
+    // Outgoing data statistics - see get_send_stats()
+    struct SendStats
+      {
+      // Total bytes given to on_cmd_send() and total bytes actually written to socket
+      uint64_t m_bytes_queued;
+      uint64_t m_bytes_sent;
+
+      // Number of commands queued and number of socket writes used to send them
+      uint32_t m_cmds_queued;
+      uint32_t m_sends;
+
+      // Number of writes where socket took only part of the queue and number of times the
+      // socket would have blocked and sending was deferred to a later update - i.e.
+      // backpressure from a slow remote IDE.
+      uint32_t m_sends_partial;
+      uint32_t m_sends_deferred;
+
+      // Number of commands queued while the unsent bytes were already past the soft cap
+      // - the remote IDE is falling far behind.
+      uint32_t m_queue_overflows;
+
+      // Largest number of bytes waiting in send queue at once
+      uint32_t m_queue_peak;
+
+      SendStats() { ::memset(this, 0, sizeof(SendStats)); }
+      };
+
   // Common Methods
 
     SSUERemote();
     ~SSUERemote();
 
     void                      process_incoming();
+    void                      process_outgoing();
+
+    const SendStats &         get_send_stats() const                { return m_send_stats; }
+    uint32_t                  get_send_queue_length() const         { return uint32_t(m_send_queue.Num()) - m_send_idx; }
 
     TSharedPtr<FInternetAddr> get_ip_address_local();
 
+    #if !UE_BUILD_SHIPPING
+      bool test_loopback(uint32_t cmd_count, uint32_t cmd_bytes, uint32_t read_bytes_per_tick);
+    #endif
+
     virtual bool              is_connected() const override;
     virtual void              set_mode(eSSLocale mode) override;
 
@@ -108,6 +145,16 @@ class SSUERemote : public SkookumRemoteRuntimeBase
 
     // Data byte index point - ADef_uint32 when not in progress
     uint32_t    m_data_idx;
+
+    // Outgoing bytes from on_cmd_send() not yet accepted by the socket.  Commands are
+    // appended back to back so several small commands go out in a single write.
+    TArray<uint8> m_send_queue;
+
+    // Index of first unsent byte in m_send_queue - bytes before it were already sent and
+    // are discarded once the queue is fully sent or they make up half of it.
+    uint32_t    m_send_idx;
+
+    SendStats   m_send_stats;
   
   };  // SSUERemote
 
@@ -19,6 +19,7 @@
 #include "SSUEBindings.hpp"
 
 #include "GenericPlatformProcess.h"
+#include <SkookumScript/SSActorClass.hpp>
 #include <chrono>
 
 
@@ -29,6 +30,27 @@
 namespace
 {
 
+  //---------------------------------------------------------------------------------------
+  // Header of a compressed compiled binary - see SSUERuntime::compress_binary().
+  // 
+  // File layout:
+  //   SSBinaryCompressedHeader
+  //   for each m_chunk_size (or less for last) bytes of the original binary:
+  //     uint32_t packed_size - equal to the chunk's original size if stored uncompressed
+  //     packed_size bytes of zlib data or the original bytes
+  //     
+  // A raw binary never starts with SSBinaryCompressed_magic so both kinds load from the
+  // same file names.
+  struct SSBinaryCompressedHeader
+    {
+    uint32_t m_magic;
+    uint32_t m_raw_size;     // Size of the original binary
+    uint32_t m_chunk_size;   // Bytes of original binary per chunk
+    uint32_t m_packed_max;   // Largest packed_size of any chunk
+    };
+
+  const uint32_t SSBinaryCompressed_magic = 0x5a4b5353u;  // "SSKZ" in little endian
+
   //---------------------------------------------------------------------------------------
   // Custom Unreal Binary Handle Structure
   struct SSBinaryHandleUE : public SSBinaryHandle
@@ -42,6 +64,12 @@ namespace
         m_size = size;
         }
 
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      virtual ~SSBinaryHandleUE()
+        {
+        FMemory::Free(m_binary_p);
+        }
+
       //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
       static SSBinaryHandleUE * create(const TCHAR * path_p)
         {
@@ -52,29 +80,139 @@ namespace
           return nullptr;
           }
     
-        int32   size     = reader_p->TotalSize();
+        int32    size  = reader_p->TotalSize();
+        uint32_t magic = 0u;
+
+        if (size >= int32(sizeof(SSBinaryCompressedHeader)))
+          {
+          reader_p->Serialize(&magic, sizeof(magic));
+          reader_p->Seek(0);
+          }
+
+        SSBinaryHandleUE * handle_p = (magic == SSBinaryCompressed_magic)
+          ? create_decompressed(reader_p)
+          : create_raw(reader_p, size);
+
+        reader_p->Close();
+        delete reader_p;
+
+        return handle_p;
+        }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      // Reads an uncompressed binary as is
+      static SSBinaryHandleUE * create_raw(FArchive * reader_p, int32 size)
+        {
         uint8 * binary_p = (uint8*)FMemory::Malloc(size);
 
         if (!binary_p)
           {
-          reader_p->Close();
-          delete reader_p;
-
           return nullptr;
           }
 
         reader_p->Serialize(binary_p, size);
-        reader_p->Close();
-        delete reader_p;
 
         return new SSBinaryHandleUE(binary_p, size);
         }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      // Reads a binary written by SSUERuntime::compress_binary() one chunk at a time -
+      // each chunk is decompressed straight into place in the final binary so only one
+      // packed chunk is ever held in memory in addition to the result.  The chunks can't
+      // be handed over as they are decompressed since the SkookumScript library parses a
+      // binary from a single contiguous buffer that it is given all at once.
+      // Returns nullptr if the binary is truncated or corrupt.
+      static SSBinaryHandleUE * create_decompressed(FArchive * reader_p)
+        {
+        SSBinaryCompressedHeader header;
+
+        reader_p->Serialize(&header, sizeof(header));
+
+        if ((header.m_raw_size == 0u) || (header.m_chunk_size == 0u) || (header.m_packed_max == 0u))
+          {
+          return nullptr;
+          }
+
+        uint8 * binary_p = (uint8*)FMemory::Malloc(header.m_raw_size);
+        uint8 * packed_p = (uint8*)FMemory::Malloc(header.m_packed_max);
+        bool    ok_b     = (binary_p != nullptr) && (packed_p != nullptr);
+
+        uint32_t offset = 0u;
+        uint32_t chunk_size;
+        uint32_t packed_size;
+
+        while (ok_b && (offset < header.m_raw_size))
+          {
+          chunk_size  = FMath::Min(header.m_chunk_size, header.m_raw_size - offset);
+          packed_size = 0u;
+          reader_p->Serialize(&packed_size, sizeof(packed_size));
+
+          if (reader_p->IsError() || (packed_size > header.m_packed_max) || (packed_size > chunk_size))
+            {
+            ok_b = false;
+            }
+          else if (packed_size == chunk_size)
+            {
+            // Stored - did not compress
+            reader_p->Serialize(binary_p + offset, chunk_size);
+            }
+          else
+            {
+            reader_p->Serialize(packed_p, packed_size);
+            ok_b = FCompression::UncompressMemory(
+              COMPRESS_ZLIB, binary_p + offset, chunk_size, packed_p, packed_size);
+            }
+
+          offset += chunk_size;
+          }
+
+        ok_b = ok_b && !reader_p->IsError();
+        FMemory::Free(packed_p);
+
+        if (!ok_b)
+          {
+          FMemory::Free(binary_p);
+
+          return nullptr;
+          }
+
+        return new SSBinaryHandleUE(binary_p, header.m_raw_size);
+        }
     };
 
 
 } // End unnamed namespace
 
 
+//---------------------------------------------------------------------------------------
+// Reads a class group binary on a worker thread for SSUERuntime::prefetch_class_group()
+class SSClassGroupLoadTask : public FNonAbandonableTask
+  {
+  public:
+
+  // Methods
+
+    SSClassGroupLoadTask(const FString & path) : m_path(path), m_handle_p(nullptr) {}
+
+    void DoWork()
+      {
+      m_handle_p = SSBinaryHandleUE::create(*m_path);
+      }
+
+    TStatId GetStatId() const
+      {
+      RETURN_QUICK_DECLARE_CYCLE_STAT(SSClassGroupLoadTask, STATGROUP_ThreadPoolAsyncTasks);
+      }
+
+  // Data Members
+
+    FString m_path;
+
+    // Loaded binary or nullptr if the load failed or has not completed yet
+    SSBinaryHandleUE * m_handle_p;
+  };
+
+
 //=======================================================================================
 // SSUERuntime Methods
 //=======================================================================================
@@ -148,6 +286,12 @@ void SSUERuntime::on_bind_routines()
   {
   A_DPRINT(A_SOURCE_STR "\nBind routines for SSUERuntime.\n");
 
+  // Binaries have been (re)loaded so any prefetched class group binaries may be out of
+  // date - drop them and read them again when needed.  The classes that the loaded group
+  // bookkeeping points to have also been recreated.
+  release_class_group_prefetches();
+  m_class_group_uses.Empty();
+
   SSUEBindings::register_all();
   }
 
@@ -157,6 +301,9 @@ void SSUERuntime::on_deinit()
   {
   A_DPRINT("\nSkookumScript shutting down.\n");
 
+  release_class_group_prefetches();
+  m_class_group_uses.Empty();
+
   #ifdef SKOOKUM_REMOTE_UNREAL
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     // Disconnect from remote client
@@ -185,6 +332,7 @@ void SSUERuntime::deinit()
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Unloads SkookumScript and cleans-up
+  get_singleton()->flush_deferred_releases();
   SkookumScript::deinitialize_session();
   SkookumScript::deinitialize();
   }
@@ -254,12 +402,14 @@ bool SSUERuntime::load_compiled_scripts(
   {
   A_DPRINT("\nSkookumScript loading previously parsed compiled binary...\n");
 
+  double start_time = FPlatformTime::Seconds();
+
   if (load_compiled_hierarchy() != SSLoadStatus_ok)
     {
     return false;
     }
 
-  A_DPRINT("  ...done!\n\n");
+  A_DPRINT("  ...done! [%.3f seconds]\n\n", FPlatformTime::Seconds() - start_time);
 
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -292,6 +442,268 @@ bool SSUERuntime::load_compiled_scripts(
   return true;
   }
 
+//---------------------------------------------------------------------------------------
+// Starts reading the binary for the demand loaded class group that `cls` belongs to on a
+// worker thread so that the file I/O is already done when the group is actually needed.
+// When the class group is later loaded get_binary_class_group() uses the prefetched
+// binary - waiting for the read to finish (or doing it right there if the worker has not
+// started it yet) if needed.
+// 
+// #Returns: true if a read was started, false if not needed or already started
+// 
+// #Notes
+//   Only the file read is done in the background - parsing the binary and adding the
+//   classes is still done by the SkookumScript library on the game thread.
+//   
+// #See: get_binary_class_group(), release_class_group_prefetches()
+bool SSUERuntime::prefetch_class_group(const SSClass & cls)
+  {
+  SSClass * root_p = cls.get_demand_loaded_root();
+
+  if ((root_p == nullptr) || root_p->is_loaded())
+    {
+    return false;
+    }
+
+  uint32 root_id = root_p->get_name_id();
+
+  if (m_class_group_loads.Contains(root_id))
+    {
+    return false;
+    }
+
+  FAsyncTask<SSClassGroupLoadTask> * task_p = new FAsyncTask<SSClassGroupLoadTask>(get_class_group_path(*root_p));
+
+  m_class_group_loads.Add(root_id, task_p);
+  task_p->StartBackgroundTask();
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Frees any prefetched class group binaries that were never used - waiting for reads
+// that are still in progress.
+// 
+// #See: prefetch_class_group()
+void SSUERuntime::release_class_group_prefetches()
+  {
+  for (auto load_iter = m_class_group_loads.CreateIterator(); load_iter; ++load_iter)
+    {
+    FAsyncTask<SSClassGroupLoadTask> * task_p = load_iter.Value();
+
+    task_p->EnsureCompletion(false);
+    delete task_p->GetTask().m_handle_p;
+    delete task_p;
+    }
+
+  m_class_group_loads.Empty();
+  }
+
+//---------------------------------------------------------------------------------------
+// Notes that the demand loaded class group that `cls` belongs to is in use so that
+// update_demand_unloads() will not unload it for at least another idle period.  Call
+// this from game code when a group is about to be used or is used in a way that
+// update_demand_unloads() cannot see - i.e. anything other than actor instances.
+// 
+// #See: update_demand_unloads(), set_demand_load_budget()
+void SSUERuntime::touch_class_group(const SSClass & cls)
+  {
+  SSClass * root_p = cls.get_demand_loaded_root();
+
+  if (root_p)
+    {
+    SSClassGroupUse * use_p = m_class_group_uses.Find(root_p->get_name_id());
+
+    if (use_p)
+      {
+      use_p->m_last_use = FPlatformTime::Seconds();
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Unloads least recently used demand loaded class groups until the groups still loaded
+// fit within the budget given to set_demand_load_budget().  Call once per frame.
+// 
+// #Returns: number of class groups unloaded
+// 
+// #Notes
+//   A group is only a candidate if it is not load locked, has not already had its unload
+//   deferred and has not been used for at least the minimum idle period.  A group whose
+//   root is an actor class counts as used for as long as it has any instances.
+//   
+//   SSClass::demand_unload() defers the unload of a class that still has instances -
+//   these are counted with get_demand_unload_deferred_count() and stay in the loaded
+//   total until the SkookumScript library completes the unload.
+//   
+//   Invocations currently running code from a group are not visible from here so the
+//   minimum idle period is what keeps an active group loaded - game code can extend it
+//   with touch_class_group().
+//   
+// #See: touch_class_group(), set_demand_load_budget()
+uint32_t SSUERuntime::update_demand_unloads()
+  {
+  if (m_class_group_uses.Num() == 0)
+    {
+    m_demand_loaded_bytes = 0u;
+
+    return 0u;
+    }
+
+  double    now          = FPlatformTime::Seconds();
+  uint32_t  loaded_bytes = 0u;
+  SSClass * root_p;
+  TArray<SSClassGroupUse *> candidates;
+
+  for (auto use_iter = m_class_group_uses.CreateIterator(); use_iter; ++use_iter)
+    {
+    SSClassGroupUse & use = use_iter.Value();
+
+    root_p = use.m_root_p;
+
+    // Unloaded by other means or deferred unload has completed
+    if (!root_p->is_loaded())
+      {
+      use_iter.RemoveCurrent();
+      continue;
+      }
+
+    // Actor class instances include those of its subclasses
+    if (root_p->is_builtin_actor_class()
+      && !static_cast<SSActorClass *>(root_p)->get_instances().is_empty())
+      {
+      use.m_last_use = now;
+      }
+
+    loaded_bytes += use.m_size;
+
+    if (!root_p->is_load_locked()
+      && !root_p->is_unload_deferred()
+      && ((now - use.m_last_use) >= m_demand_idle_min))
+      {
+      candidates.Add(&use);
+      }
+    }
+
+  if ((m_demand_budget == 0u) || (loaded_bytes <= m_demand_budget) || (candidates.Num() == 0))
+    {
+    m_demand_loaded_bytes = loaded_bytes;
+
+    return 0u;
+    }
+
+  // Least recently used first - note that TArray sorts arrays of pointers by the
+  // pointed-to values.
+  candidates.Sort([](const SSClassGroupUse & lhs, const SSClassGroupUse & rhs) { return lhs.m_last_use < rhs.m_last_use; });
+
+  uint32_t unload_count    = 0u;
+  int32    candidate_count = candidates.Num();
+
+  for (int32 idx = 0; (idx < candidate_count) && (loaded_bytes > m_demand_budget); idx++)
+    {
+    SSClassGroupUse * use_p = candidates[idx];
+
+    if (use_p->m_root_p->demand_unload())
+      {
+      loaded_bytes          -= use_p->m_size;
+      m_demand_unload_bytes += use_p->m_size;
+      unload_count++;
+      }
+    else
+      {
+      // Wait at least another idle period before trying it again
+      use_p->m_last_use = now;
+      m_demand_unloads_deferred++;
+      }
+    }
+
+  // Unloaded records are dropped on the next update once their roots report not loaded
+  m_demand_unloads      += unload_count;
+  m_demand_loaded_bytes  = loaded_bytes;
+
+  return unload_count;
+  }
+
+//---------------------------------------------------------------------------------------
+// Drops a reference to the supplied object like SSInstance::dereference() except that if
+// it was the last reference the object is not freed right away - it is queued and freed
+// later by update_deferred_releases().  Use it for objects that may own large graphs
+// (a List with thousands of items, etc.) so that freeing them does not spike the frame.
+// 
+// #Notes
+//   Once queued the object must not be referenced again.  So clear any AIdPtr that refers
+//   to it - as USkookumScriptComponent::OnUnregister() does - before calling this.
+//   Minds are not routed through here since their lifetime is managed by SSMind itself.
+//   
+// #See:  update_deferred_releases(), flush_deferred_releases()
+void SSUERuntime::release_deferred(SSInstance * obj_p)
+  {
+  obj_p->dereference_delay();
+
+  if (obj_p->get_references() == 0u)
+    {
+    m_release_queue.append(*obj_p);
+    m_release_peak = a_max(m_release_peak, m_release_queue.get_length());
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Frees up to `release_max` objects queued by release_deferred().  A List is drained
+// one item per step, with items that lose their last reference queued above it, so
+// a large list is spread across as many updates as needed.
+// 
+// #Returns: number of release steps taken - less than `release_max` if the queue emptied
+// #See:     release_deferred(), flush_deferred_releases()
+uint32_t SSUERuntime::update_deferred_releases(
+  uint32_t release_max // = SSUERuntime_release_max_default
+  )
+  {
+  uint32_t     released = 0u;
+  SSInstance * obj_p;
+  SSInstance * item_p;
+  SSList *     list_p;
+
+  while ((released < release_max) && m_release_queue.is_filled())
+    {
+    released++;
+    obj_p = m_release_queue.get_last();
+
+    if (obj_p->get_class() == SSBrain::ms_list_class_p)
+      {
+      list_p = obj_p->as<SSList>();
+
+      if (list_p->get_count())
+        {
+        // Take over the reference that the list held
+        item_p = list_p->get_instances().pop_last();
+        release_deferred(item_p);
+
+        continue;
+        }
+      }
+
+    m_release_queue.pop_last();
+    obj_p->ensure_reference();
+    }
+
+  return released;
+  }
+
+//---------------------------------------------------------------------------------------
+// Frees everything queued by release_deferred() right away - called before the session
+// is torn down so nothing is left referring to script classes that are being unloaded.
+// 
+// #See: release_deferred(), update_deferred_releases()
+void SSUERuntime::flush_deferred_releases()
+  {
+  if (m_release_queue.is_filled())
+    {
+    A_DPRINT("SkookumScript flushing %u deferred releases (peak %u).\n", m_release_queue.get_length(), m_release_peak);
+
+    update_deferred_releases(UINT32_MAX);
+    }
+  }
+
 //---------------------------------------------------------------------------------------
 // Determines if binary for class hierarchy and associated info exists.
 // 
@@ -332,14 +744,184 @@ SSBinaryHandle * SSUERuntime::get_binary_hierarchy()
 // #Modifiers:  virtual - overridden from SkookumRuntimeBase
 // #Author(s):  Conan Reis
 SSBinaryHandle * SSUERuntime::get_binary_class_group(const SSClass & cls)
+  {
+  SSBinaryHandleUE * handle_p = nullptr;
+
+  // Use binary from prefetch_class_group() if there is one
+  FAsyncTask<SSClassGroupLoadTask> * task_p = nullptr;
+
+  if (m_class_group_loads.RemoveAndCopyValue(cls.get_name_id(), task_p))
+    {
+    // Needed now - wait for it or just do the read here if it has not started yet
+    task_p->EnsureCompletion();
+    handle_p = task_p->GetTask().m_handle_p;
+    delete task_p;
+    }
+
+  if (handle_p == nullptr)
+    {
+    handle_p = SSBinaryHandleUE::create(*get_class_group_path(cls));
+    }
+
+  // Track the group so that update_demand_unloads() can unload it again if needed
+  SSClass * root_p = cls.get_demand_loaded_root();
+
+  if (handle_p && root_p)
+    {
+    SSClassGroupUse & use = m_class_group_uses.FindOrAdd(root_p->get_name_id());
+
+    use.m_root_p   = root_p;
+    use.m_size     = handle_p->m_size;
+    use.m_last_use = FPlatformTime::Seconds();
+    }
+
+  return handle_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Gets the file path of the binary for group of classes with specified class as root.
+FString SSUERuntime::get_class_group_path(const SSClass & cls) const
   {
   FString compiled_file = get_compiled_path();
   
   // $Revisit - CReis Should use fast custom uint32_t to hex string function.
   compiled_file += a_cstr_format("/Class[%x].sk-bin", cls.get_name_id());
-  return SSBinaryHandleUE::create(*compiled_file);
+
+  return compiled_file;
   }
 
+//---------------------------------------------------------------------------------------
+// Rewrites a compiled binary (Classes.sk-bin or a Class[id].sk-bin class group) in place
+// as zlib compressed chunks.  The loader detects compressed binaries by their header so
+// compressed and uncompressed binaries can be mixed.  Intended for use when packaging -
+// smaller binaries load faster when reading them is slower than decompressing them.
+// 
+// Run the `sk.CompressBinaries` console command to compress Classes.sk-bin and all the
+// class group binaries in get_compiled_path() - from the editor once the scripts are
+// compiled and before packaging, or unattended with:
+//   UE4Editor.exe <project> -game -ExecCmds="sk.CompressBinaries, quit"
+// 
+// zlib rather than a faster codec such as LZ4 since zlib is the only codec FCompression
+// has in this engine version.  It decompresses several times slower than LZ4 but packs
+// smaller - use `sk.BenchmarkBinaryLoad` to check that it loads faster than the raw
+// binaries on the target's storage before shipping compressed binaries.
+// 
+// #Returns: true if the binary was compressed, false if it could not be read or written
+//   or was already compressed
+// 
+// #Params
+//   path_p: file to compress
+//   chunk_size: bytes of the original binary to compress at a time
+//   dest_path_p: file to write the compressed binary to or nullptr to replace `path_p`
+//   
+// #See: SSBinaryHandleUE::create_decompressed()
+bool SSUERuntime::compress_binary(
+  const TCHAR * path_p,
+  uint32_t      chunk_size, // = SSUERuntime_binary_chunk_default
+  const TCHAR * dest_path_p // = nullptr
+  )
+  {
+  TArray<uint8> raw;
+
+  if (!FFileHelper::LoadFileToArray(raw, path_p) || (chunk_size == 0u) || (raw.Num() == 0)
+    || ((raw.Num() >= int32(sizeof(uint32_t))) && (*reinterpret_cast<uint32_t *>(raw.GetData()) == SSBinaryCompressed_magic)))
+    {
+    return false;
+    }
+
+  SSBinaryCompressedHeader header;
+
+  header.m_magic      = SSBinaryCompressed_magic;
+  header.m_raw_size   = uint32_t(raw.Num());
+  header.m_chunk_size = chunk_size;
+  header.m_packed_max = 0u;
+
+  TArray<uint8> packed;
+
+  packed.AddUninitialized(sizeof(header));
+
+  // Room for zlib's worst case - a little larger than the original
+  TArray<uint8> chunk;
+
+  chunk.AddUninitialized(chunk_size + (chunk_size >> 8u) + 64u);
+
+  uint32_t offset = 0u;
+  uint32_t raw_chunk_size;
+  int32    packed_size;
+  uint8 *  raw_p = raw.GetData();
+
+  while (offset < header.m_raw_size)
+    {
+    raw_chunk_size = FMath::Min(chunk_size, header.m_raw_size - offset);
+    packed_size    = chunk.Num();
+
+    // Store chunks that do not get smaller as they are
+    if (!FCompression::CompressMemory(COMPRESS_ZLIB, chunk.GetData(), packed_size, raw_p + offset, raw_chunk_size)
+      || (uint32_t(packed_size) >= raw_chunk_size))
+      {
+      packed_size = raw_chunk_size;
+      FMemory::Memcpy(chunk.GetData(), raw_p + offset, raw_chunk_size);
+      }
+
+    packed.Append(reinterpret_cast<uint8 *>(&packed_size), sizeof(uint32_t));
+    packed.Append(chunk.GetData(), packed_size);
+    header.m_packed_max = FMath::Max(header.m_packed_max, uint32_t(packed_size));
+    offset += raw_chunk_size;
+    }
+
+  FMemory::Memcpy(packed.GetData(), &header, sizeof(header));
+
+  if (!FFileHelper::SaveArrayToFile(packed, dest_path_p ? dest_path_p : path_p))
+    {
+    return false;
+    }
+
+  A_DPRINT("  Compressed '%ls' %u -> %u bytes\n", path_p, header.m_raw_size, uint32_t(packed.Num()));
+
+  return true;
+  }
+
+#if !UE_BUILD_SHIPPING
+
+//---------------------------------------------------------------------------------------
+// Times loading a compiled binary the same way the runtime does - reading it and, if it
+// is compressed, decompressing it.
+// 
+// #Returns: average seconds per load or a negative number if it could not be loaded
+// 
+// #Params
+//   path_p: raw or compressed binary to load
+//   passes: number of times to load it
+//   
+// #Notes
+//   The file is likely in the OS file cache after the first pass so this mostly times
+//   decompression rather than the storage.
+//   
+// #See: compress_binary(), the `sk.BenchmarkBinaryLoad` console command
+double SSUERuntime::time_binary_load(
+  const TCHAR * path_p,
+  uint32_t      passes
+  )
+  {
+  double start_secs = FPlatformTime::Seconds();
+
+  for (uint32_t pass = 0u; pass < passes; pass++)
+    {
+    SSBinaryHandleUE * handle_p = SSBinaryHandleUE::create(path_p);
+
+    if (!handle_p)
+      {
+      return -1.0;
+      }
+
+    delete handle_p;
+    }
+
+  return (FPlatformTime::Seconds() - start_secs) / double(a_max(passes, 1u));
+  }
+
+#endif  // !UE_BUILD_SHIPPING
+
 
 #if (SKOOKUM & SS_DEBUG) && defined(A_SYMBOL_STR_DB)
   
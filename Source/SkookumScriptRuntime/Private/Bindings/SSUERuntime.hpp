@@ -17,16 +17,51 @@
 // Includes
 //=======================================================================================
 
+#include <AgogCore/APArray.hpp>
 #include <SkookumScript/SkookumRuntimeBase.hpp>
 #include "../SkookumScriptListenerManager.hpp"
 
 #include "Platform.h"  // Set up base types, etc for the platform
 
 
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+// Default number of objects freed per update_deferred_releases() call
+const uint32_t SSUERuntime_release_max_default = 512u;
+
+// Default number of original bytes in each chunk of a compress_binary() binary
+const uint32_t SSUERuntime_binary_chunk_default = 64u * 1024u;
+
+// Default number of seconds a demand loaded class group must go unused before
+// update_demand_unloads() will consider unloading it
+const double SSUERuntime_demand_idle_min_default = 10.0;
+
+
 //=======================================================================================
 // Global Structures
 //=======================================================================================
 
+// Pre-declarations
+class SSInstance;
+class SSClassGroupLoadTask;
+
+//---------------------------------------------------------------------------------------
+// Bookkeeping for a loaded demand loaded class group - see SSUERuntime::update_demand_unloads()
+struct SSClassGroupUse
+  {
+  // Demand loaded root class of the group
+  SSClass * m_root_p;
+
+  // Size in bytes of the group's compiled binary - used as an estimate of the memory
+  // that its loaded members take up.
+  uint32_t m_size;
+
+  // Time in seconds (FPlatformTime::Seconds()) that the group was loaded or last used
+  double m_last_use;
+  };
+
 //---------------------------------------------------------------------------------------
 // SkookumScript Runtime Hooks for Unreal
 // - Input/Output Init/Update/Deinit Manager
@@ -38,7 +73,7 @@ class SSUERuntime : public SkookumRuntimeBase
 
   // Methods
 
-    SSUERuntime() : m_compiled_file_b(false), m_listener_manager(256, 256) { ms_default_p = this; }
+    SSUERuntime() : m_compiled_file_b(false), m_listener_manager(256, 256), m_release_peak(0u), m_demand_budget(0u), m_demand_idle_min(SSUERuntime_demand_idle_min_default), m_demand_loaded_bytes(0u), m_demand_unloads(0u), m_demand_unload_bytes(0u), m_demand_unloads_deferred(0u) { ms_default_p = this; }
     ~SSUERuntime() {}
 
     // Script Loading / Binding
@@ -47,6 +82,35 @@ class SSUERuntime : public SkookumRuntimeBase
 
       bool load_compiled_scripts(bool ensure_atomics = true, SSClass ** ignore_classes_pp = nullptr, uint32_t ignore_count = 0u);
 
+      bool prefetch_class_group(const SSClass & cls);
+      void release_class_group_prefetches();
+
+      static bool compress_binary(const TCHAR * path_p, uint32_t chunk_size = SSUERuntime_binary_chunk_default, const TCHAR * dest_path_p = nullptr);
+
+      #if !UE_BUILD_SHIPPING
+        static double time_binary_load(const TCHAR * path_p, uint32_t passes);
+      #endif
+
+    // Deferred Release
+
+      void     release_deferred(SSInstance * obj_p);
+      uint32_t update_deferred_releases(uint32_t release_max = SSUERuntime_release_max_default);
+      void     flush_deferred_releases();
+      uint32_t get_deferred_release_count() const  { return m_release_queue.get_length(); }
+      uint32_t get_deferred_release_peak() const   { return m_release_peak; }
+
+    // Demand Unload
+
+      void     set_demand_load_budget(uint32_t budget_bytes, double idle_min = SSUERuntime_demand_idle_min_default) { m_demand_budget = budget_bytes; m_demand_idle_min = idle_min; }
+      uint32_t get_demand_load_budget() const           { return m_demand_budget; }
+      double   get_demand_idle_min() const              { return m_demand_idle_min; }
+      void     touch_class_group(const SSClass & cls);
+      uint32_t update_demand_unloads();
+      uint32_t get_demand_loaded_bytes() const          { return m_demand_loaded_bytes; }
+      uint32_t get_demand_unload_count() const          { return m_demand_unloads; }
+      uint32_t get_demand_unload_bytes() const          { return m_demand_unload_bytes; }
+      uint32_t get_demand_unload_deferred_count() const { return m_demand_unloads_deferred; }
+
     // Overridden from SkookumRuntimeBase
 
       // Binary Serialization / Loading Overrides
@@ -74,6 +138,10 @@ class SSUERuntime : public SkookumRuntimeBase
 
   protected:
 
+    // Internal Methods
+
+      FString get_class_group_path(const SSClass & cls) const;
+
     // Internal class methods
 
       static void deinit();
@@ -85,6 +153,36 @@ class SSUERuntime : public SkookumRuntimeBase
 
       SkookumScriptListenerManager m_listener_manager;
 
+      // Class group binaries being read (or already read) on a worker thread by
+      // prefetch_class_group() - keyed on demand load root class name id.
+      TMap<uint32, FAsyncTask<SSClassGroupLoadTask> *> m_class_group_loads;
+
+      // Objects whose last reference was dropped with release_deferred() and that are
+      // waiting to be freed by update_deferred_releases().  Used as a stack so that the
+      // items of a List being drained are freed before the rest of the queue.
+      APArray<SSInstance> m_release_queue;
+
+      // Largest length m_release_queue has reached
+      uint32_t m_release_peak;
+
+      // Loaded demand loaded class groups - keyed on root class name id.
+      TMap<uint32, SSClassGroupUse> m_class_group_uses;
+
+      // Number of bytes of demand loaded class groups to allow before the least recently
+      // used ones are unloaded.  0 disables automatic unloading.
+      uint32_t m_demand_budget;
+
+      // Minimum seconds a class group must go unused before it may be unloaded
+      double m_demand_idle_min;
+
+      // Bytes of demand loaded class groups as of the last update_demand_unloads()
+      uint32_t m_demand_loaded_bytes;
+
+      // Eviction stats - totals since startup
+      uint32_t m_demand_unloads;
+      uint32_t m_demand_unload_bytes;
+      uint32_t m_demand_unloads_deferred;
+
   };  // SSUERuntime
 
 
@@ -18,6 +18,7 @@
 #include "SkookumScriptRuntimePrivatePCH.h"
 #include "../Classes/SkookumScriptComponent.h"
 #include "Bindings/SSUEBindings.hpp"
+#include "Bindings/SSUERuntime.hpp"
 #include "SSUEActor.generated.hpp"
 
 
@@ -87,14 +88,9 @@ void USkookumScriptComponent::OnRegister()
       {
     set_default_class:
       // Find most derived UE4 class known to SkookumScript
-      UClass * obj_uclass_p = actor_p->GetClass();
-      SSClass ** class_pp = SSUE::g_class_map_u2s.Find(actor_p->GetClass());
-      for (; !class_pp && obj_uclass_p; obj_uclass_p = obj_uclass_p->GetSuperClass())
-        {
-        class_pp = SSUE::g_class_map_u2s.Find(obj_uclass_p);
-        }
-      SS_ASSERTX(class_pp, a_cstr_format("No parent class of %S is known to SkookumScript!", *obj_uclass_p->GetName()));
-      class_p = class_pp ? *class_pp : SSBrain::get_class(ASymbol_Actor); // Recover from bad user input
+      class_p = SSUE::get_class_inherited(actor_p->GetClass());
+      SS_ASSERTX(class_p, a_cstr_format("No parent class of %S is known to SkookumScript!", *actor_p->GetClass()->GetName()));
+      if (!class_p) class_p = SSBrain::get_class(ASymbol_Actor); // Recover from bad user input
       }
 
     // Based on the desired class, create SSInstance or SSDataInstance
@@ -128,7 +124,12 @@ void USkookumScriptComponent::OnUnregister()
   Super::OnUnregister();
 
   //SSDebug::print_ide(a_str_format("USkookumScriptComponent::OnUnregister() 0x%p\n", this), SSLocale_ide, SSDPrintType_trace);
-  m_instance_p->dereference();
+  // Free the instance with the other deferred releases rather than right here in the
+  // middle of actor teardown.  Forget the owner actor first since it may be destroyed
+  // before the instance is released.
+  m_instance_p->set(static_cast<AActor * const &>(nullptr));
+  SSUERuntime::get_singleton()->release_deferred(m_instance_p);
+  m_instance_p = nullptr;
   }
 
 //---------------------------------------------------------------------------------------
@@ -0,0 +1,508 @@
+//=======================================================================================
+// SkookumScript C++ library.
+// Copyright (c) 2015 Agog Labs Inc.,
+// All rights reserved.
+//
+// SkookumScript Unreal Engine console commands
+//
+// Diagnostic, benchmark and maintenance commands - type them in the game or editor
+// console.  Not available in shipping builds.
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "SkookumScriptRuntimePrivatePCH.h"
+
+#include "Bindings/SSUERuntime.hpp"
+#include "Bindings/SSUERemote.hpp"
+#include "Bindings/SSUEBindings.hpp"
+
+#include <SkookumScript/SSInteger.hpp>
+
+
+#if !UE_BUILD_SHIPPING
+
+namespace
+{
+
+  //---------------------------------------------------------------------------------------
+  // Gets the integer console command argument at `idx` or `default_value` if not present
+  int32 get_arg_int(const TArray<FString> & args, int32 idx, int32 default_value)
+    {
+    return args.IsValidIndex(idx) ? FCString::Atoi(*args[idx]) : default_value;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Finds the SSClass mapped to `uclass_p` or its nearest mapped superclass by walking the
+  // superclasses through SSUE::g_class_map_u2s every time - as SSUE::get_class_inherited()
+  // did before it cached its results.
+  SSClass * get_class_walked(UClass * uclass_p)
+    {
+    for (UClass * super_uclass_p = uclass_p; super_uclass_p; super_uclass_p = super_uclass_p->GetSuperClass())
+      {
+      SSClass ** class_pp = SSUE::g_class_map_u2s.Find(super_uclass_p);
+
+      if (class_pp)
+        {
+        return *class_pp;
+        }
+      }
+
+    return nullptr;
+    }
+
+
+  //=======================================================================================
+  // Commands
+  //=======================================================================================
+
+  //---------------------------------------------------------------------------------------
+  // Checks that SSUERuntime::release_deferred() spreads freeing a large List across
+  // several updates - one release step per item plus one per item freed - that the
+  // queue is empty once drained and that every instance it made went back to the
+  // instance pool.  Anything already queued is flushed first.
+  //
+  // # Console:  sk.CheckDeferredRelease [item_count] [release_max]
+  void cmd_check_deferred_release(const TArray<FString> & args)
+    {
+    SSUERuntime * runtime_p   = SSUERuntime::get_singleton();
+    uint32_t      item_count  = uint32_t(FMath::Max(1, get_arg_int(args, 0, 1000000)));
+    uint32_t      release_max = uint32_t(FMath::Max(1, get_arg_int(args, 1, int32(SSUERuntime_release_max_default))));
+
+    runtime_p->flush_deferred_releases();
+
+    uint32_t     used_before = SSInstance::get_pool().get_count_used();
+    SSInstance * list_p      = SSList::as_instance();
+    SSList *     items_p     = list_p->as<SSList>();
+
+    for (uint32_t idx = 0u; idx < item_count; idx++)
+      {
+      items_p->append(*SSInteger::as_instance(SSIntegerType(idx)), false);
+      }
+
+    runtime_p->release_deferred(list_p);
+
+    uint32_t queued_count = runtime_p->get_deferred_release_count();
+    uint32_t update_count = 0u;
+    uint32_t step_count   = 0u;
+
+    while (runtime_p->get_deferred_release_count() && (update_count <= (item_count * 2u) + 1u))
+      {
+      step_count += runtime_p->update_deferred_releases(release_max);
+      update_count++;
+      }
+
+    uint32_t used_after      = SSInstance::get_pool().get_count_used();
+    uint32_t step_expected   = (item_count * 2u) + 1u;
+    uint32_t update_expected = (step_expected + release_max - 1u) / release_max;
+    bool     passed_b        = (queued_count == 1u)
+      && (runtime_p->get_deferred_release_count() == 0u)
+      && (step_count == step_expected)
+      && (update_count == update_expected)
+      && (used_after == used_before);
+
+    ADebug::print_format(
+      "SkookumScript deferred release check %s - %u items, %u per update\n"
+      "  steps: %u (expected %u), updates: %u (expected %u), left queued: %u, instances leaked: %d\n",
+      passed_b ? "passed" : "FAILED",
+      item_count, release_max,
+      step_count, step_expected, update_count, update_expected,
+      runtime_p->get_deferred_release_count(),
+      int32(used_after - used_before));
+
+    SS_ASSERTX(passed_b, "SSUERuntime deferred release did not drain as expected!");
+    }
+
+  FAutoConsoleCommand g_cmd_check_deferred_release(
+    TEXT("sk.CheckDeferredRelease"),
+    TEXT("Checks that freeing a large SkookumScript List is spread across updates. Args: [item_count] [release_max]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(cmd_check_deferred_release));
+
+  //---------------------------------------------------------------------------------------
+  // Stress tests demand unloading - loads every demand loaded class group over and over
+  // with a small budget and no idle period so that update_demand_unloads() has to keep
+  // unloading the least recently used groups.  After each update the loaded groups must
+  // fit in the budget unless an unload was deferred or a group is load locked.  The
+  // previous budget and idle period are restored afterwards.
+  //
+  // # Console:  sk.StressDemandUnload [cycles] [budget_kb]
+  void cmd_stress_demand_unload(const TArray<FString> & args)
+    {
+    SSUERuntime * runtime_p = SSUERuntime::get_singleton();
+    int32         cycles    = FMath::Max(1, get_arg_int(args, 0, 10));
+    uint32_t      budget    = uint32_t(FMath::Max(1, get_arg_int(args, 1, 64))) * 1024u;
+
+    // Gather demand loaded roots
+    TArray<SSClass *>  roots;
+    bool               locked_b       = false;
+    const tSSClasses & classes        = SSBrain::get_classes();
+    SSClass **         classes_pp     = classes.get_array();
+    SSClass **         classes_end_pp = classes_pp + classes.get_length();
+
+    for (; classes_pp < classes_end_pp; classes_pp++)
+      {
+      if ((*classes_pp)->is_demand_loaded_root())
+        {
+        roots.Add(*classes_pp);
+        locked_b |= (*classes_pp)->is_load_locked();
+        }
+      }
+
+    if (roots.Num() == 0)
+      {
+      ADebug::print("SkookumScript demand unload stress test skipped - no demand loaded classes.\n");
+
+      return;
+      }
+
+    uint32_t budget_prev     = runtime_p->get_demand_load_budget();
+    double   idle_prev       = runtime_p->get_demand_idle_min();
+    uint32_t unloads_start   = runtime_p->get_demand_unload_count();
+    uint32_t deferred_start  = runtime_p->get_demand_unload_deferred_count();
+    uint32_t load_count      = 0u;
+    uint32_t over_count      = 0u;
+    uint32_t fail_count      = 0u;
+    uint32_t loaded_peak     = 0u;
+    uint32_t loaded_bytes;
+
+    runtime_p->set_demand_load_budget(budget, 0.0);
+
+    for (int32 cycle = 0; cycle < cycles; cycle++)
+      {
+      for (SSClass * root_p : roots)
+        {
+        if (!root_p->is_loaded())
+          {
+          runtime_p->load_compiled_class_group(root_p);
+          load_count++;
+          }
+
+        runtime_p->update_demand_unloads();
+
+        loaded_bytes = runtime_p->get_demand_loaded_bytes();
+        loaded_peak  = FMath::Max(loaded_peak, loaded_bytes);
+
+        if (loaded_bytes > budget)
+          {
+          over_count++;
+
+          // Only acceptable if something could not be unloaded
+          bool deferred_b = false;
+
+          for (SSClass * deferred_root_p : roots)
+            {
+            deferred_b |= deferred_root_p->is_unload_deferred();
+            }
+
+          if (!locked_b && !deferred_b)
+            {
+            fail_count++;
+            }
+          }
+        }
+      }
+
+    runtime_p->set_demand_load_budget(budget_prev, idle_prev);
+
+    ADebug::print_format(
+      "SkookumScript demand unload stress test %s - %d groups, %d cycles, %u KB budget\n"
+      "  loads: %u, unloads: %u, deferred: %u, peak loaded: %u KB, over budget: %u (unexplained %u)\n",
+      (fail_count == 0u) ? "passed" : "FAILED",
+      roots.Num(), cycles, budget / 1024u,
+      load_count,
+      runtime_p->get_demand_unload_count() - unloads_start,
+      runtime_p->get_demand_unload_deferred_count() - deferred_start,
+      loaded_peak / 1024u, over_count, fail_count);
+
+    SS_ASSERTX(fail_count == 0u, "SSUERuntime demand unloading went over budget!");
+    }
+
+  FAutoConsoleCommand g_cmd_stress_demand_unload(
+    TEXT("sk.StressDemandUnload"),
+    TEXT("Repeatedly loads all SkookumScript demand loaded class groups with a small unload budget. Args: [cycles] [budget_kb]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(cmd_stress_demand_unload));
+
+  //---------------------------------------------------------------------------------------
+  // Compresses all the compiled binaries (Classes.sk-bin and the Class[id].sk-bin class
+  // groups) in place - see SSUERuntime::compress_binary().  Run it after the scripts
+  // have been compiled and before packaging.  Binaries that are already compressed are
+  // left as they are.
+  //
+  // # Console:  sk.CompressBinaries [chunk_kb]
+  void cmd_compress_binaries(const TArray<FString> & args)
+    {
+    uint32_t        chunk_size    = uint32_t(FMath::Max(1, get_arg_int(args, 0, int32(SSUERuntime_binary_chunk_default / 1024u)))) * 1024u;
+    const FString & compiled_path = SSUERuntime::get_singleton()->get_compiled_path();
+    uint32_t        packed_count  = 0u;
+
+    TArray<FString> file_names;
+
+    IFileManager::Get().FindFiles(file_names, *(compiled_path / TEXT("*.sk-bin")), true, false);
+
+    for (const FString & file_name : file_names)
+      {
+      if (SSUERuntime::compress_binary(*(compiled_path / file_name), chunk_size))
+        {
+        packed_count++;
+        }
+      }
+
+    ADebug::print_format(
+      "SkookumScript compressed %u of %d compiled binaries in '%ls' (others already compressed or unreadable)\n",
+      packed_count, file_names.Num(), *compiled_path);
+    }
+
+  FAutoConsoleCommand g_cmd_compress_binaries(
+    TEXT("sk.CompressBinaries"),
+    TEXT("Compresses the compiled SkookumScript binaries in place for packaging. Args: [chunk_kb]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(cmd_compress_binaries));
+
+  //---------------------------------------------------------------------------------------
+  // Compares the compressed size and load time (read plus decompress) of each compiled
+  // binary with its raw version.  A compressed copy of each raw binary is written to a
+  // temporary file so the compiled binaries are left as they are.  Binaries that are
+  // already compressed are skipped.
+  //
+  // # Console:  sk.BenchmarkBinaryLoad [passes] [chunk_kb]
+  void cmd_benchmark_binary_load(const TArray<FString> & args)
+    {
+    uint32_t        passes        = uint32_t(FMath::Max(1, get_arg_int(args, 0, 20)));
+    uint32_t        chunk_size    = uint32_t(FMath::Max(1, get_arg_int(args, 1, int32(SSUERuntime_binary_chunk_default / 1024u)))) * 1024u;
+    const FString & compiled_path = SSUERuntime::get_singleton()->get_compiled_path();
+    FString         packed_path   = FPaths::CreateTempFilename(*FPaths::GameSavedDir(), TEXT("SkookumBinary"), TEXT(".sk-bin"));
+    IFileManager &  file_manager  = IFileManager::Get();
+    int64           raw_total     = 0;
+    int64           packed_total  = 0;
+    double          raw_secs      = 0.0;
+    double          packed_secs   = 0.0;
+    uint32_t        file_count    = 0u;
+
+    TArray<FString> file_names;
+
+    file_manager.FindFiles(file_names, *(compiled_path / TEXT("*.sk-bin")), true, false);
+
+    ADebug::print_format(
+      "SkookumScript binary load benchmark - %u passes, %u KB chunks, '%ls'\n",
+      passes, chunk_size / 1024u, *compiled_path);
+
+    for (const FString & file_name : file_names)
+      {
+      FString raw_path = compiled_path / file_name;
+
+      if (!SSUERuntime::compress_binary(*raw_path, chunk_size, *packed_path))
+        {
+        ADebug::print_format("  %ls: skipped - already compressed or unreadable\n", *file_name);
+        continue;
+        }
+
+      int64  raw_size         = file_manager.FileSize(*raw_path);
+      int64  packed_size      = file_manager.FileSize(*packed_path);
+      double raw_load_secs    = SSUERuntime::time_binary_load(*raw_path, passes);
+      double packed_load_secs = SSUERuntime::time_binary_load(*packed_path, passes);
+
+      ADebug::print_format(
+        "  %ls: %lld -> %lld bytes (%.1f%%), load %.3fms raw, %.3fms compressed\n",
+        *file_name,
+        static_cast<long long>(raw_size),
+        static_cast<long long>(packed_size),
+        (100.0 * double(packed_size)) / double(FMath::Max(raw_size, int64(1))),
+        raw_load_secs * 1000.0,
+        packed_load_secs * 1000.0);
+
+      raw_total    += raw_size;
+      packed_total += packed_size;
+      raw_secs     += raw_load_secs;
+      packed_secs  += packed_load_secs;
+      file_count++;
+      }
+
+    file_manager.Delete(*packed_path);
+
+    ADebug::print_format(
+      "  total of %u binaries: %lld -> %lld bytes, load %.3fms raw, %.3fms compressed\n",
+      file_count,
+      static_cast<long long>(raw_total),
+      static_cast<long long>(packed_total),
+      raw_secs * 1000.0,
+      packed_secs * 1000.0);
+    }
+
+  FAutoConsoleCommand g_cmd_benchmark_binary_load(
+    TEXT("sk.BenchmarkBinaryLoad"),
+    TEXT("Compares compressed and raw SkookumScript binary sizes and load times. Args: [passes] [chunk_kb]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(cmd_benchmark_binary_load));
+
+  //---------------------------------------------------------------------------------------
+  // Times SSUE::get_class_inherited() against the plain superclass walk through
+  // SSUE::g_class_map_u2s over every loaded UClass and checks that both find the same
+  // SSClass.  The cache is cleared first so its first pass includes filling it.
+  //
+  // # Console:  sk.BenchmarkClassLookup [passes]
+  void cmd_benchmark_class_lookup(const TArray<FString> & args)
+    {
+    int32            passes = FMath::Max(1, get_arg_int(args, 0, 100));
+    TArray<UClass *> uclasses;
+
+    for (TObjectIterator<UClass> uclass_iter; uclass_iter; ++uclass_iter)
+      {
+      uclasses.Add(*uclass_iter);
+      }
+
+    // Summing the results keeps the lookups from being optimized away
+    uintptr_t walk_sum   = 0u;
+    uintptr_t cached_sum = 0u;
+    double    start_secs = FPlatformTime::Seconds();
+
+    for (int32 pass = 0; pass < passes; pass++)
+      {
+      for (UClass * uclass_p : uclasses)
+        {
+        walk_sum += reinterpret_cast<uintptr_t>(get_class_walked(uclass_p));
+        }
+      }
+
+    double walk_secs = FPlatformTime::Seconds() - start_secs;
+
+    SSUE::reset_class_lookups();
+    start_secs = FPlatformTime::Seconds();
+
+    for (UClass * uclass_p : uclasses)
+      {
+      cached_sum += reinterpret_cast<uintptr_t>(SSUE::get_class_inherited(uclass_p));
+      }
+
+    double fill_secs = FPlatformTime::Seconds() - start_secs;
+
+    start_secs = FPlatformTime::Seconds();
+
+    for (int32 pass = 1; pass < passes; pass++)
+      {
+      for (UClass * uclass_p : uclasses)
+        {
+        cached_sum += reinterpret_cast<uintptr_t>(SSUE::get_class_inherited(uclass_p));
+        }
+      }
+
+    double cached_secs = FPlatformTime::Seconds() - start_secs;
+
+    uint32_t mismatch_count = 0u;
+
+    for (UClass * uclass_p : uclasses)
+      {
+      if (SSUE::get_class_inherited(uclass_p) != get_class_walked(uclass_p))
+        {
+        mismatch_count++;
+        }
+      }
+
+    bool passed_b = (mismatch_count == 0u) && (walk_sum == cached_sum);
+
+    ADebug::print_format(
+      "SkookumScript class lookup benchmark %s - %d UClasses x %d passes\n"
+      "  superclass walk: %.3fms, cached: %.3fms first pass + %.3fms other passes, mismatches: %u\n",
+      passed_b ? "passed" : "FAILED",
+      uclasses.Num(), passes,
+      walk_secs * 1000.0, fill_secs * 1000.0, cached_secs * 1000.0,
+      mismatch_count);
+
+    SS_ASSERTX(passed_b, "SSUE::get_class_inherited() does not match the superclass walk!");
+    }
+
+  FAutoConsoleCommand g_cmd_benchmark_class_lookup(
+    TEXT("sk.BenchmarkClassLookup"),
+    TEXT("Times cached SkookumScript UClass to SSClass lookups against the superclass walk. Args: [passes]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(cmd_benchmark_class_lookup));
+
+  //---------------------------------------------------------------------------------------
+  // Times the atomic List@any?() and List@do() against script loops equivalent to their
+  // Core overlay script versions.  The script loops have the closure body inlined so
+  // they leave out the closure call and are a lower bound for the script versions.  Each
+  // script is run with a List of `item_count` Integers as `this` and includes parsing it.
+  //
+  // # Console:  sk.BenchmarkIteration [item_count] [passes]
+  void cmd_benchmark_iteration(const TArray<FString> & args)
+    {
+    uint32_t item_count = uint32_t(FMath::Max(1, get_arg_int(args, 0, 100000)));
+    int32    passes     = FMath::Max(1, get_arg_int(args, 1, 10));
+
+    // Items stay non-negative for any?() since each pass negates them twice
+    const char * scripts_pp[][2] =
+      {
+        { "List@any?() atomic", "any?[item < 0]" },
+        { "List@any?() script", "!count: length\n!idx: 0\n!result?: false\nloop\n  [\n  if idx >= count [exit]\n  if at(idx) < 0 [result?: true exit]\n  idx++\n  ]\nresult?" },
+        { "List@do() atomic",   "do[item.negate]" },
+        { "List@do() script",   "!count: length\n!idx: 0\nloop\n  [\n  if idx >= count [exit]\n  at(idx).negate\n  idx++\n  ]\nthis" },
+      };
+    const uint32_t script_count = A_COUNT_OF(scripts_pp);
+    double         script_secs[script_count] = {0.0};
+    bool           passed_b = true;
+
+    SSInstance * list_p  = SSList::as_instance();
+    SSList *     items_p = list_p->as<SSList>();
+
+    for (uint32_t idx = 0u; idx < item_count; idx++)
+      {
+      items_p->append(*SSInteger::as_instance(SSIntegerType(idx)), false);
+      }
+
+    for (int32 pass = 0; pass < passes; pass++)
+      {
+      for (uint32_t script_idx = 0u; script_idx < script_count; script_idx++)
+        {
+        double start_secs = FPlatformTime::Seconds();
+
+        passed_b &= (SSParser::invoke_script(scripts_pp[script_idx][1], nullptr, nullptr, list_p, false) == SSParser::Result_ok);
+        script_secs[script_idx] += FPlatformTime::Seconds() - start_secs;
+        }
+      }
+
+    list_p->dereference();
+
+    ADebug::print_format(
+      "SkookumScript iteration benchmark %s - %u items x %d passes\n",
+      passed_b ? "passed" : "FAILED", item_count, passes);
+
+    for (uint32_t script_idx = 0u; script_idx < script_count; script_idx++)
+      {
+      ADebug::print_format("  %s: %.3fms\n", scripts_pp[script_idx][0], script_secs[script_idx] * 1000.0);
+      }
+
+    SS_ASSERTX(passed_b, "SkookumScript iteration benchmark scripts did not run!");
+    }
+
+  FAutoConsoleCommand g_cmd_benchmark_iteration(
+    TEXT("sk.BenchmarkIteration"),
+    TEXT("Times the atomic SkookumScript List iteration methods against script loops. Args: [item_count] [passes]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(cmd_benchmark_iteration));
+
+  #ifdef SKOOKUM_REMOTE_UNREAL
+
+  //---------------------------------------------------------------------------------------
+  // Sends commands over a loopback connection to a stand-in remote IDE that reads slowly
+  // and checks they all arrive in order without the send queue blocking the game thread.
+  // The defaults queue 32MB so the queue also goes past its soft cap.
+  //
+  // # Console:  sk.TestRemoteLoopback [cmd_count] [cmd_kb] [read_kb_per_tick]
+  void cmd_test_remote_loopback(const TArray<FString> & args)
+    {
+    uint32_t cmd_count = uint32_t(FMath::Max(1, get_arg_int(args, 0, 4096)));
+    uint32_t cmd_bytes = uint32_t(FMath::Max(1, get_arg_int(args, 1, 8))) * 1024u;
+    uint32_t read_max  = uint32_t(FMath::Max(1, get_arg_int(args, 2, 4))) * 1024u;
+    bool     passed_b  = static_cast<SSUERemote *>(SSUERemote::ms_client_p)->test_loopback(cmd_count, cmd_bytes, read_max);
+
+    SS_ASSERTX(passed_b, "SSUERemote send queue loopback test failed!");
+    }
+
+  FAutoConsoleCommand g_cmd_test_remote_loopback(
+    TEXT("sk.TestRemoteLoopback"),
+    TEXT("Tests the SkookumScript remote IDE send queue against a slow reader on loopback. Args: [cmd_count] [cmd_kb] [read_kb_per_tick]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(cmd_test_remote_loopback));
+
+  #endif  // SKOOKUM_REMOTE_UNREAL
+
+} // End unnamed namespace
+
+#endif  // !UE_BUILD_SHIPPING
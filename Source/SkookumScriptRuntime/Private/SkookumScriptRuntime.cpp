@@ -14,6 +14,21 @@
 #endif
 
 
+//---------------------------------------------------------------------------------------
+// Per frame stats - view in game/editor with console command: stat SkookumScript
+DECLARE_STATS_GROUP(TEXT("SkookumScript"), STATGROUP_SkookumScript, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Script Update"), STAT_SkookumScriptUpdate, STATGROUP_SkookumScript);
+DECLARE_CYCLE_STAT(TEXT("Remote IDE"), STAT_SkookumScriptRemote, STATGROUP_SkookumScript);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Updating Minds"), STAT_SkookumScriptMinds, STATGROUP_SkookumScript);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Remote Unsent Bytes"), STAT_SkookumScriptRemoteUnsent, STATGROUP_SkookumScript);
+DECLARE_CYCLE_STAT(TEXT("Deferred Release"), STAT_SkookumScriptRelease, STATGROUP_SkookumScript);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Release Queue"), STAT_SkookumScriptReleaseQueue, STATGROUP_SkookumScript);
+DECLARE_CYCLE_STAT(TEXT("Demand Unload"), STAT_SkookumScriptDemandUnload, STATGROUP_SkookumScript);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Demand Loaded Bytes"), STAT_SkookumScriptDemandLoaded, STATGROUP_SkookumScript);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Demand Unloads"), STAT_SkookumScriptDemandUnloads, STATGROUP_SkookumScript);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Demand Unloads Deferred"), STAT_SkookumScriptDemandDeferred, STATGROUP_SkookumScript);
+
+
 //---------------------------------------------------------------------------------------
 class FSkookumScriptRuntime : public ISkookumScriptRuntime, public FTickableGameObject
   {
@@ -40,6 +55,7 @@ class FSkookumScriptRuntime : public ISkookumScriptRuntime, public FTickableGame
 
     void            OnWorldInitPre(UWorld * world_p, const UWorld::InitializationValues init_vals);
     void            OnWorldCleanup(UWorld * world_p, bool session_ended_b, bool cleanup_resources_b);
+    void            OnPostGarbageCollect();
 
     // Class Methods
 
@@ -61,6 +77,7 @@ class FSkookumScriptRuntime : public ISkookumScriptRuntime, public FTickableGame
 
     FWorldDelegates::FWorldInitializationEvent::FDelegate   m_on_world_init_pre_delegate;
     FWorldDelegates::FWorldCleanupEvent::FDelegate          m_on_world_cleanup_delegate;
+    FSimpleDelegate                                         m_on_post_gc_delegate;
   };
 
 
@@ -410,6 +427,9 @@ void FSkookumScriptRuntime::StartupModule()
   FWorldDelegates::OnPreWorldInitialization.Add(m_on_world_init_pre_delegate);
   FWorldDelegates::OnWorldCleanup.Add(m_on_world_cleanup_delegate);
 
+  m_on_post_gc_delegate = FSimpleDelegate::CreateRaw(this, &FSkookumScriptRuntime::OnPostGarbageCollect);
+  FCoreUObjectDelegates::PostGarbageCollect.Add(m_on_post_gc_delegate);
+
   // Hook up Unreal memory allocator
   AMemory::override_functions(&Agog::malloc_func, &Agog::free_func, &Agog::req_byte_size_func);
 
@@ -460,12 +480,20 @@ void FSkookumScriptRuntime::OnWorldCleanup(UWorld * world_p, bool session_ended_
     A_DPRINT(
       "SkookumScript resetting session...\n"
       "  cleaning up...\n");
+    m_runtime.flush_deferred_releases();
     SkookumScript::deinitialize_session();
     SkookumScript::initialize_session();
     A_DPRINT("  ...done!\n\n");
     }
   }
 
+//---------------------------------------------------------------------------------------
+void FSkookumScriptRuntime::OnPostGarbageCollect()
+  {
+  // Forget cached UClasses since some may have just been collected
+  SSUE::reset_class_lookups();
+  }
+
 //---------------------------------------------------------------------------------------
 // Called before the module has been unloaded
 void FSkookumScriptRuntime::PreUnloadCallback()
@@ -480,6 +508,8 @@ void FSkookumScriptRuntime::ShutdownModule()
   {
   A_DPRINT(A_SOURCE_STR " Shutting down SkookumScript plug-in modules\n");
 
+  FCoreUObjectDelegates::PostGarbageCollect.Remove(m_on_post_gc_delegate);
+
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Clean up SkookumScript
   m_runtime.on_deinit();
@@ -525,18 +555,49 @@ bool FSkookumScriptRuntime::IsTickableInEditor() const
 void FSkookumScriptRuntime::Tick(float deltaTime)
   {
   #ifdef SKOOKUM_REMOTE_UNREAL
+    {
+    SCOPE_CYCLE_COUNTER(STAT_SkookumScriptRemote);
+
     // Remote communication to and from SkookumScript IDE.
     // Needs to be called whether in editor or game and whether paused or not
     // $Revisit - CReis This is probably a hack. The remote client update should probably
     // live somewhere other than a tick method such as its own thread.
+    m_remote_client.process_outgoing();
     m_remote_client.process_incoming();
+
+    SET_DWORD_STAT(STAT_SkookumScriptRemoteUnsent, m_remote_client.get_send_queue_length());
+    }
   #endif
 
   if (m_game_world_p)
     {
+    SCOPE_CYCLE_COUNTER(STAT_SkookumScriptUpdate);
+    SET_DWORD_STAT(STAT_SkookumScriptMinds, SSMind::get_updating_minds().get_count());
+
     // Intentionally still called even when paused and deltaTime is 0.0f
     m_runtime.update(deltaTime);
     }
+
+  // Free a slice of any objects queued with SSUERuntime::release_deferred()
+  if (m_runtime.get_deferred_release_count())
+    {
+    SCOPE_CYCLE_COUNTER(STAT_SkookumScriptRelease);
+
+    m_runtime.update_deferred_releases();
+    }
+
+  SET_DWORD_STAT(STAT_SkookumScriptReleaseQueue, m_runtime.get_deferred_release_count());
+
+  // Unload least recently used demand loaded class groups if over budget
+  {
+  SCOPE_CYCLE_COUNTER(STAT_SkookumScriptDemandUnload);
+
+  m_runtime.update_demand_unloads();
+  }
+
+  SET_DWORD_STAT(STAT_SkookumScriptDemandLoaded, m_runtime.get_demand_loaded_bytes());
+  SET_DWORD_STAT(STAT_SkookumScriptDemandUnloads, m_runtime.get_demand_unload_count());
+  SET_DWORD_STAT(STAT_SkookumScriptDemandDeferred, m_runtime.get_demand_unload_deferred_count());
   }
 
 //---------------------------------------------------------------------------------------
@@ -553,16 +614,11 @@ TStatId FSkookumScriptRuntime::GetStatId() const
 void FSkookumScriptRuntime::set_game_world(UWorld * world_p)
   {
   m_game_world_p = world_p;
-  SSClass * obj_class_p = SSBrain::get_class(ASymbol_Object);
-  SS_ASSERTX(obj_class_p, "Couldn't find the World class!");
-  uint32_t var_pos;
-  if (obj_class_p->get_class_data().find(ASymbolX_c_world, AMatch_first_found, &var_pos))
-    {
-    obj_class_p->get_class_data().get_at(var_pos)->set_data(world_p ? SSUE::get_object_instance(world_p) : SSBrain::ms_nil_p);
-    }
-  else
+  SSTypedData * world_var_p = SSUE::get_world_var();
+  SS_ASSERTX(world_var_p, "Couldn't set the @@world class member variable!");
+  if (world_var_p)
     {
-    SS_ASSERTX(false, "Couldn't find the @@world class member variable!");
+    world_var_p->set_data(world_p ? SSUE::get_object_instance(world_p) : SSBrain::ms_nil_p);
     }
   }
 